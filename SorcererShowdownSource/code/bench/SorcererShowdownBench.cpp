@@ -0,0 +1,525 @@
+#include "code/header/GameManagement/BatchRunner.h"
+#include "code/header/GameManagement/BattlefieldHeader.h"
+#include "code/header/GameManagement/BattleManager.h"
+#include "code/header/Characters/Character.h"
+#include "code/header/CharacterCreator/CharacterCreator.h"
+#include "json.hpp"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// Fixed corpus of seeded scenarios. Seeds and battle counts never change
+// between runs, so result_hash only moves when battle behaviour does.
+struct BenchScenario {
+	std::string name;
+	std::vector<std::pair<std::string, int>> fighters;
+	int battles;
+	std::uint64_t seed;
+};
+
+// Every global new in the benchmark is counted, plain, over-aligned and
+// nothrow alike, so a run can report how much of the battle still goes
+// through the general purpose heap. The battle arena and the turn scratch are
+// not counted, only what they fall back on (the scratch spills through the
+// aligned form). The array forms forward to these by default.
+static std::atomic<long long> heap_allocations{ 0 };
+
+static void* CountedAllocate(size_t size, size_t alignment) noexcept {
+	heap_allocations.fetch_add(1, std::memory_order_relaxed);
+	if (size == 0) size = 1;
+	if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) return std::malloc(size);
+#ifdef _WIN32
+	return _aligned_malloc(size, alignment);
+#else
+	return std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+}
+
+static void CountedFree(void* p, size_t alignment) noexcept {
+#ifdef _WIN32
+	if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+		_aligned_free(p);
+		return;
+	}
+#endif
+	std::free(p);
+}
+
+void* operator new(size_t size) {
+	if (void* p = CountedAllocate(size, 0)) return p;
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment) {
+	if (void* p = CountedAllocate(size, static_cast<size_t>(alignment))) return p;
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+	return CountedAllocate(size, 0);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+	return CountedAllocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+	CountedFree(p, 0);
+}
+
+void operator delete(void* p, size_t) noexcept {
+	CountedFree(p, 0);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept {
+	CountedFree(p, 0);
+}
+
+void operator delete(void* p, std::align_val_t alignment) noexcept {
+	CountedFree(p, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* p, size_t, std::align_val_t alignment) noexcept {
+	CountedFree(p, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* p, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+	CountedFree(p, static_cast<size_t>(alignment));
+}
+
+struct BenchResult {
+	std::string name;
+	int battles = 0;
+	long long rounds = 0;
+	long long turns = 0;
+	double seconds = 0.0;
+	BattleTiming timing;
+	std::uint64_t result_hash = 0;
+	long long peak_rss_kb = 0;
+	long long arena_bytes = 0;
+	long long arena_allocations = 0;
+	long long heap_allocations = 0;
+};
+
+static const std::vector<BenchScenario> scenarios = {
+	{ "mirror_1v1", { { "Gojo", 2 } }, 20000, 1001 },
+	{ "free_for_all_6", { { "Gojo", 1 }, { "Sukuna", 1 }, { "Yuta Okkotsu", 1 }, { "Toji Fushiguro", 1 }, { "Mahito", 1 }, { "Hakari", 1 } }, 5000, 2002 },
+	{ "mahito_swarm", { { "Mahito", 4 }, { "Yuta Okkotsu", 1 } }, 10000, 3003 },
+	{ "domain_heavy", { { "Gojo", 2 }, { "Sukuna", 2 }, { "Hakari", 2 }, { "Yuta Okkotsu", 2 } }, 1500, 4004 },
+};
+
+static long long PeakRssKb() {
+#ifdef _WIN32
+	PROCESS_MEMORY_COUNTERS counters{};
+	if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) return 0;
+	return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+#else
+	rusage usage{};
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+#ifdef __APPLE__
+	return usage.ru_maxrss / 1024;
+#else
+	return usage.ru_maxrss;
+#endif
+#endif
+}
+
+static std::uint64_t HashResult(std::uint64_t hash, const BattleResult& result) {
+	for (std::uint64_t v : { static_cast<std::uint64_t>(result.outcome), static_cast<std::uint64_t>(result.winner_id), static_cast<std::uint64_t>(result.rounds), static_cast<std::uint64_t>(result.winner_health * 10.0) }) {
+		hash = (hash ^ v) * 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+static std::vector<const Character*> Lineup(const BattleCreator& bc, const BenchScenario& scenario) {
+	std::vector<const Character*> lineup;
+	for (const auto& [name, count] : scenario.fighters) {
+		const Character* entry = BatchRunner::FindRosterEntry(bc, name);
+		for (int n = 0; n < count; n++) lineup.push_back(entry);
+	}
+	return lineup;
+}
+
+static void SetUpBattle(Battlefield& bf, const BenchScenario& scenario, int battle, const std::vector<const Character*>& lineup) {
+	bf.context.Reseed(scenario.seed + static_cast<std::uint64_t>(battle));
+	bf.context.Config().turn_cap = 500;
+	bf.context.Config().spectator_mode = true;
+	bf.context.SetSink(std::make_unique<NullSink>());
+	for (const Character* entry : lineup) BatchRunner::AddFighter(bf, *entry);
+}
+
+static BenchResult RunScenario(const BattleCreator& bc, const BenchScenario& scenario, int battles) {
+	std::vector<const Character*> lineup = Lineup(bc, scenario);
+
+	BenchResult bench;
+	bench.name = scenario.name;
+	bench.battles = battles;
+	bench.result_hash = 0xcbf29ce484222325ULL;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < battles; i++) {
+		Battlefield bf;
+		SetUpBattle(bf, scenario, i, lineup);
+		long long allocations_before = heap_allocations.load(std::memory_order_relaxed);
+		BattleResult result = BatchRunner::RunBattle(bf, &bench.timing);
+		bench.heap_allocations += heap_allocations.load(std::memory_order_relaxed) - allocations_before;
+		bench.rounds += result.rounds;
+		bench.turns += result.turns;
+		bench.result_hash = HashResult(bench.result_hash, result);
+		BattleArena::Stats arena = bf.arena.GetStats();
+		bench.arena_bytes += static_cast<long long>(arena.bytes_used);
+		bench.arena_allocations += static_cast<long long>(arena.allocations);
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	bench.seconds = elapsed.count();
+	bench.peak_rss_kb = PeakRssKb();
+	return bench;
+}
+
+// Allocation check: plays the corpus round by round and counts heap
+// allocations in settled rounds, where nobody joined or left during the round
+// or the one before it, so every buffer has already grown to fit the roster.
+// Those rounds are expected to make none.
+struct AllocationCheck {
+	std::string name;
+	long long turns = 0;
+	long long allocations = 0;
+	long long settled_turns = 0;
+	long long settled_allocations = 0;
+	size_t scratch_overflows = 0;
+};
+
+static AllocationCheck CheckAllocations(const BattleCreator& bc, const BenchScenario& scenario, int battles) {
+	std::vector<const Character*> lineup = Lineup(bc, scenario);
+	AllocationCheck check;
+	check.name = scenario.name;
+
+	for (int i = 0; i < battles; i++) {
+		Battlefield bf;
+		SetUpBattle(bf, scenario, i, lineup);
+		BattleManager manager;
+		BattleResult result;
+		bool over = false;
+		bool first_round = true;
+		unsigned previous_generation = bf.context.Index().Generation();
+		while (!over && result.rounds < bf.context.Config().turn_cap) {
+			int turns_before = result.turns;
+			unsigned generation = bf.context.Index().Generation();
+			long long allocations_before = heap_allocations.load(std::memory_order_relaxed);
+			over = BatchRunner::PlayRound(bf, manager, result);
+			long long made = heap_allocations.load(std::memory_order_relaxed) - allocations_before;
+
+			check.turns += result.turns - turns_before;
+			check.allocations += made;
+			if (!first_round && generation == previous_generation && bf.context.Index().Generation() == generation) {
+				check.settled_turns += result.turns - turns_before;
+				check.settled_allocations += made;
+			}
+			first_round = false;
+			previous_generation = generation;
+		}
+		check.scratch_overflows += bf.context.Scratch().Overflows();
+	}
+	return check;
+}
+
+static int RunAllocationCheck(const std::string& only, double scale) {
+	BattleCreator bc;
+	BatchRunner::LoadRoster(bc, BatchOptions{});
+
+	bool clean = true;
+	bool ran = false;
+	std::println("{:<16} {:>10} {:>14} {:>14} {:>16} {:>18}", "scenario", "turns", "allocs/turn", "settled turns", "settled allocs", "scratch overflows");
+	for (const auto& scenario : scenarios) {
+		if (!only.empty() && scenario.name != only) continue;
+		int battles = std::max(1, static_cast<int>(scenario.battles * scale));
+		AllocationCheck c = CheckAllocations(bc, scenario, battles);
+		std::println("{:<16} {:>10} {:>14.3f} {:>14} {:>16} {:>18}", c.name, c.turns,
+			c.turns > 0 ? static_cast<double>(c.allocations) / c.turns : 0.0, c.settled_turns, c.settled_allocations, c.scratch_overflows);
+		clean = clean && c.settled_allocations == 0;
+		ran = true;
+	}
+	if (!ran) {
+		std::println(stderr, "No scenario named \"{}\"", only);
+		return 1;
+	}
+	if (!clean) {
+		std::println(stderr, "Settled rounds allocated from the heap");
+		return 1;
+	}
+	std::println("No heap allocations in settled rounds");
+	return 0;
+}
+
+// Scaling sweep: one battlefield per size, timed per round rather than per
+// battle since a 100k fighter battle would never finish.
+struct ScalingPoint {
+	int fighters = 0;
+	long long rounds = 0;
+	long long turns = 0;
+	std::chrono::nanoseconds round_time{ 0 };
+	long long peak_rss_kb = 0;
+};
+
+// Synthetic roster built through the same JSON path as characters.json,
+// with every stat and component rolled from a fixed seed.
+static std::vector<std::unique_ptr<Character>> GenerateRoster(int size, std::uint64_t seed) {
+	static const std::array<const char*, 4> types = { "Sorcerer", "Sorcerer", "Cursed Spirit", "Physically Gifted" };
+	static const std::array<const char*, 4> brains = { "Aggressive", "Reactive", "Randomized", "Brawler" };
+	static const std::array<const char*, 5> techniques = { "Limitless", "Shrine", "Private Pure Love Train", "Idle Transfiguration", "Copy" };
+	static const std::array<const char*, 5> domains = { "Infinite Void", "Malevolent Shrine", "Authentic Mutual Love", "Idle Death Gamble", "Self Embodiment of Perfection" };
+	static const std::array<const char*, 4> tools = { "The Inverted Spear of Heaven", "Playful Cloud", "Split Soul Katana", "Katana" };
+
+	BattleRandom rng(seed);
+	CharacterCreator creator;
+	std::vector<std::unique_ptr<Character>> roster;
+	for (int i = 0; i < size; i++) {
+		std::string type = types[rng.Next(0, static_cast<int>(types.size()) - 1)];
+		nlohmann::json j = {
+			{ "name", std::format("Synthetic {}", i + 1) },
+			{ "type", type },
+			{ "ai_type", brains[rng.Next(0, static_cast<int>(brains.size()) - 1)] },
+			{ "base_attack_damage", rng.Next(10, 120) * 1.0 },
+			{ "hp", rng.Next(500, 3000) * 1.0 },
+		};
+		if (type == "Physically Gifted") {
+			j["strength"] = rng.Next(50, 400) * 1.0;
+			j["equipped_tool"] = tools[rng.Next(0, static_cast<int>(tools.size()) - 1)];
+		}
+		else {
+			j["ce"] = rng.Next(1000, 8000) * 1.0;
+			j["regen"] = rng.Next(20, 300) * 1.0;
+			j["blackflash_chance"] = rng.Next(1, 20);
+			j["technique"] = techniques[rng.Next(0, static_cast<int>(techniques.size()) - 1)];
+			if (rng.Chance(1, 2)) j["domain"] = domains[rng.Next(0, static_cast<int>(domains.size()) - 1)];
+			if (type == "Sorcerer") j["rct_proficiency"] = rng.Chance(1, 2) ? "Absolute" : "Basic";
+		}
+		if (std::unique_ptr<Character> c = creator.CreateJsonObject(j)) roster.push_back(std::move(c));
+	}
+	return roster;
+}
+
+static ScalingPoint RunScalingPoint(const std::vector<std::unique_ptr<Character>>& roster, int fighters, std::uint64_t seed, std::chrono::duration<double> budget) {
+	ScalingPoint point;
+	point.fighters = fighters;
+	std::uint64_t battle = 0;
+
+	while (point.round_time < budget) {
+		Battlefield bf;
+		bf.context.Reseed(seed + battle++);
+		bf.context.Config().spectator_mode = true;
+		bf.context.SetSink(std::make_unique<NullSink>());
+		for (int i = 0; i < fighters; i++) {
+			BatchRunner::AddFighter(bf, *roster[static_cast<size_t>(i) % roster.size()]);
+		}
+
+		BattleManager manager;
+		BattleResult result;
+		bool over = false;
+		while (!over && point.round_time < budget) {
+			int turns_before = result.turns;
+			auto start = std::chrono::steady_clock::now();
+			over = BatchRunner::PlayRound(bf, manager, result);
+			point.round_time += std::chrono::steady_clock::now() - start;
+			point.rounds++;
+			point.turns += result.turns - turns_before;
+		}
+	}
+	point.peak_rss_kb = PeakRssKb();
+	return point;
+}
+
+static double PerSecond(double count, double seconds) {
+	return seconds > 0.0 ? count / seconds : 0.0;
+}
+
+static double NsPerDecision(const BattleTiming& timing) {
+	return timing.decisions > 0 ? static_cast<double>(timing.decision_time.count()) / timing.decisions : 0.0;
+}
+
+static void PrintUsage() {
+	std::println(stderr, "Usage: SorcererShowdownBench [--output FILE] [--scale X] [--only NAME]");
+	std::println(stderr, "       SorcererShowdownBench --scaling [--max-fighters N] [--budget SEC] [--output FILE]");
+	std::println(stderr, "       SorcererShowdownBench --check-allocs [--scale X] [--only NAME]");
+	std::println(stderr, "  --output FILE       write results as JSON to FILE (default bench_results.json, - for stdout)");
+	std::println(stderr, "  --scale X           multiply every scenario's battle count by X (default 1)");
+	std::println(stderr, "  --only NAME         run just the named scenario");
+	std::println(stderr, "  --scaling           sweep battlefield size over a synthetic roster instead of the scenario corpus");
+	std::println(stderr, "  --max-fighters N    largest battlefield in the sweep (default 100000)");
+	std::println(stderr, "  --budget SEC        round time spent per battlefield size, at least one round (default 0.5)");
+	std::println(stderr, "  --check-allocs      count heap allocations per round instead of timing, fail if a settled round makes any");
+}
+
+static bool WriteJson(const nlohmann::json& root, const std::string& output_path) {
+	if (output_path == "-") {
+		std::println("{}", root.dump(2));
+		return true;
+	}
+	std::ofstream file(output_path, std::ios::out | std::ios::trunc);
+	if (!file) {
+		std::println(stderr, "Could not open output file \"{}\"", output_path);
+		return false;
+	}
+	file << root.dump(2) << '\n';
+	std::println("Results written to {}", output_path);
+	return true;
+}
+
+static int RunCorpus(const std::string& output_path, const std::string& only, double scale) {
+	BattleCreator bc;
+	BatchRunner::LoadRoster(bc, BatchOptions{});
+
+	std::vector<BenchResult> results;
+	FILE* table = output_path == "-" ? stderr : stdout;
+	std::println(table, "{:<16} {:>8} {:>12} {:>12} {:>12} {:>14} {:>14} {:>12}", "scenario", "battles", "battles/s", "rounds/s", "turns/s", "ns/decision", "arena B/battle", "peak RSS kB");
+	for (const auto& scenario : scenarios) {
+		if (!only.empty() && scenario.name != only) continue;
+		int battles = std::max(1, static_cast<int>(scenario.battles * scale));
+		BenchResult r = RunScenario(bc, scenario, battles);
+		std::println(table, "{:<16} {:>8} {:>12.1f} {:>12.1f} {:>12.1f} {:>14.1f} {:>14} {:>12}", r.name, r.battles,
+			PerSecond(r.battles, r.seconds), PerSecond(static_cast<double>(r.rounds), r.seconds), PerSecond(static_cast<double>(r.turns), r.seconds),
+			NsPerDecision(r.timing), r.arena_bytes / r.battles, r.peak_rss_kb);
+		results.push_back(std::move(r));
+	}
+	if (results.empty()) {
+		std::println(stderr, "No scenario named \"{}\"", only);
+		return 1;
+	}
+
+	nlohmann::json root;
+	root["benchmark"] = "SorcererShowdownBench";
+	root["scale"] = scale;
+	root["peak_rss_kb"] = PeakRssKb();
+	nlohmann::json list = nlohmann::json::array();
+	for (const auto& r : results) {
+		list.push_back({
+			{ "name", r.name },
+			{ "battles", r.battles },
+			{ "rounds", r.rounds },
+			{ "turns", r.turns },
+			{ "seconds", r.seconds },
+			{ "battles_per_sec", PerSecond(r.battles, r.seconds) },
+			{ "rounds_per_sec", PerSecond(static_cast<double>(r.rounds), r.seconds) },
+			{ "turns_per_sec", PerSecond(static_cast<double>(r.turns), r.seconds) },
+			{ "ns_per_decision", NsPerDecision(r.timing) },
+			{ "arena_bytes_per_battle", r.arena_bytes / r.battles },
+			{ "arena_allocations_per_battle", r.arena_allocations / r.battles },
+			{ "heap_allocations_per_turn", r.turns > 0 ? static_cast<double>(r.heap_allocations) / r.turns : 0.0 },
+			{ "peak_rss_kb", r.peak_rss_kb },
+			{ "result_hash", std::format("{:016x}", r.result_hash) }
+		});
+	}
+	root["scenarios"] = list;
+	return WriteJson(root, output_path) ? 0 : 1;
+}
+
+// Sizes follow a 1-2-5 series so the curve has even spacing on a log axis.
+// ns/turn is flat for linear rounds and grows with the fighter count when a
+// round is quadratic.
+static int RunScaling(const std::string& output_path, int max_fighters, double budget_seconds) {
+	const std::uint64_t seed = 5005;
+	std::vector<std::unique_ptr<Character>> roster = GenerateRoster(64, seed);
+	std::chrono::duration<double> budget(budget_seconds);
+
+	std::vector<int> sizes;
+	for (int decade = 1; decade <= max_fighters; decade *= 10) {
+		for (int step : { 2, 5, 10 }) {
+			int size = decade * step;
+			if (size <= max_fighters && (sizes.empty() || sizes.back() != size)) sizes.push_back(size);
+		}
+		if (decade > max_fighters / 10) break;
+	}
+	if (sizes.empty() || sizes.back() != max_fighters) sizes.push_back(max_fighters);
+
+	std::vector<ScalingPoint> points;
+	FILE* table = output_path == "-" ? stderr : stdout;
+	std::println(table, "{:>10} {:>8} {:>14} {:>12} {:>8} {:>12}", "fighters", "rounds", "ms/round", "ns/turn", "x base", "peak RSS kB");
+	for (int size : sizes) {
+		ScalingPoint p = RunScalingPoint(roster, size, seed, budget);
+		double ns_per_turn = p.turns > 0 ? static_cast<double>(p.round_time.count()) / p.turns : 0.0;
+		double base = points.empty() ? ns_per_turn : static_cast<double>(points.front().round_time.count()) / std::max(1LL, points.front().turns);
+		std::println(table, "{:>10} {:>8} {:>14.3f} {:>12.1f} {:>8.2f} {:>12}", p.fighters, p.rounds,
+			p.round_time.count() / 1e6 / std::max(1LL, p.rounds), ns_per_turn, base > 0.0 ? ns_per_turn / base : 0.0, p.peak_rss_kb);
+		points.push_back(p);
+	}
+
+	nlohmann::json root;
+	root["benchmark"] = "SorcererShowdownBench";
+	root["mode"] = "scaling";
+	root["seed"] = seed;
+	root["budget_seconds"] = budget_seconds;
+	nlohmann::json list = nlohmann::json::array();
+	for (const auto& p : points) {
+		list.push_back({
+			{ "fighters", p.fighters },
+			{ "rounds", p.rounds },
+			{ "turns", p.turns },
+			{ "ms_per_round", p.round_time.count() / 1e6 / std::max(1LL, p.rounds) },
+			{ "ns_per_turn", p.turns > 0 ? static_cast<double>(p.round_time.count()) / p.turns : 0.0 },
+			{ "peak_rss_kb", p.peak_rss_kb }
+		});
+	}
+	root["scaling"] = list;
+	return WriteJson(root, output_path) ? 0 : 1;
+}
+
+static bool ParsePositive(const std::string& text, double& out) {
+	try {
+		size_t used = 0;
+		out = std::stod(text, &used);
+		return used == text.size() && out > 0.0;
+	}
+	catch (const std::exception&) {
+		return false;
+	}
+}
+
+int main(int argc, char* argv[]) {
+	std::string output_path = "bench_results.json";
+	std::string only = "";
+	double scale = 1.0;
+	bool scaling = false;
+	bool check_allocs = false;
+	double max_fighters = 100000;
+	double budget = 0.5;
+
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "--scaling") {
+			scaling = true;
+			continue;
+		}
+		if (arg == "--check-allocs") {
+			check_allocs = true;
+			continue;
+		}
+		if (i + 1 >= argc) {
+			PrintUsage();
+			return 1;
+		}
+		std::string value = argv[++i];
+		bool valid = true;
+		if (arg == "--output") output_path = value;
+		else if (arg == "--only") only = value;
+		else if (arg == "--scale") valid = ParsePositive(value, scale);
+		else if (arg == "--max-fighters") valid = ParsePositive(value, max_fighters) && max_fighters >= 2;
+		else if (arg == "--budget") valid = ParsePositive(value, budget);
+		else {
+			PrintUsage();
+			return 1;
+		}
+		if (!valid) {
+			std::println(stderr, "Invalid value \"{}\" for {}", value, arg);
+			return 1;
+		}
+	}
+
+	if (check_allocs) return RunAllocationCheck(only, scale);
+	if (scaling) return RunScaling(output_path, static_cast<int>(max_fighters), budget);
+	return RunCorpus(output_path, only, scale);
+}
@@ -1,10 +1,11 @@
 #pragma once
+#include "code/header/GameManagement/BattleArena.h"
 class Character;
 class CurseUser;
 class Sorcerer;
 struct Battlefield;
 
-struct CharacterBrain {
+struct CharacterBrain : ArenaAllocated {
     virtual ~CharacterBrain() = default;
     void ExecuteTurn(Character* user, Battlefield& bf);
     virtual std::unique_ptr<CharacterBrain> Clone() const = 0;
@@ -2,6 +2,7 @@
 #include "code/header/CharacterCreator/AI/CharacterAI.h"
 
 struct Randomized: public CharacterBrain {
+    static constexpr std::string_view roster_name = "Randomized";
     std::unique_ptr<CharacterBrain> Clone() const override;
 protected:
     Character* GetTarget(Character* user, Battlefield& bf) override;
@@ -4,9 +4,17 @@
 
 using json = nlohmann::json;
 struct BattleCreator;
+class TuningTable;
 
 class CharacterCreator : public JSONLoader<Character> {
+	// applied to every character before the entry's own "tuning" overrides
+	const TuningTable* tuning = nullptr;
 public:
+	CharacterCreator() = default;
+	explicit CharacterCreator(const TuningTable* tuning);
+
 	std::unique_ptr<Character> CreateJsonObject(const json&) override;
 	void LoadJsonObject(BattleCreator&) override;
-};
\ No newline at end of file
+	// Reads bc.tuning_path into the roster's tuning table, if the file exists.
+	void LoadTuning(BattleCreator&);
+};
@@ -0,0 +1,44 @@
+#pragma once
+#include "code/header/CharacterCreator/RosterReader.h"
+
+// Binary index of a roster's "characters" entries, written next to the
+// roster (characters.json -> characters.json.cache) the first time it is
+// read and reused for as long as the roster's bytes hash the same. Each
+// entry keeps its name, its span in the roster and its source position, so
+// a warm start maps the cache and indexes the roster without lexing it.
+// It is only an index: an entry is still parsed from the roster's JSON the
+// first time it is built.
+//
+// Layout, little endian: a Header, one Record per entry, then the names.
+// Name offsets are from the start of the file, spans from the start of the
+// roster.
+class RosterCache {
+public:
+	static constexpr std::uint32_t version = 3;
+
+	static std::filesystem::path PathFor(const std::filesystem::path& roster);
+
+	// Delivers every cached entry in roster order and returns true when the
+	// cache at path was built by this version from exactly this source text.
+	// Otherwise returns false without delivering anything. Names point into
+	// the cache and only last for the call.
+	static bool Read(const std::filesystem::path& path, std::string_view source, const RosterReader::EntryCallback&);
+
+	// Collects entries while the JSON is being read, then writes the cache.
+	class Builder {
+		struct Pending {
+			size_t offset;
+			size_t size;
+			size_t name_offset;
+			size_t name_size;
+			RosterPosition at;
+		};
+		std::vector<Pending> entries;
+		std::string names;
+	public:
+		void Add(const RosterSpan&, const RosterPosition&);
+		// Written to a temporary file and renamed into place, so concurrent
+		// workers never see half a cache. False if it could not be written.
+		bool Save(const std::filesystem::path& path, std::string_view source) const;
+	};
+};
@@ -0,0 +1,57 @@
+#pragma once
+#include "code/header/CharacterCreator/RosterReader.h"
+#include "code/header/CharacterCreator/TuningTable.h"
+class Character;
+class MappedFile;
+
+// The characters a battle can be set up from: the built-ins, which are
+// constructed up front, then every roster entry by name and span. A roster
+// entry is parsed and built the first time it is asked for, so loading a
+// roster costs one scan however many characters it defines. An entry that
+// fails to build is reported and dropped, as if it had never been listed.
+// Every character, built-in or not, gets the tuning table as it is built.
+class RosterIndex {
+	struct Source {
+		std::string path;
+		std::unique_ptr<MappedFile> file;
+	};
+	struct Entry {
+		std::string name;
+		std::unique_ptr<Character> character;
+		size_t source = 0;
+		size_t offset = 0;
+		size_t size = 0;
+		RosterPosition at;
+	};
+	std::vector<Source> sources;
+	std::vector<Entry> entries;
+	TuningTable tuning;
+
+	bool Materialize(Entry&);
+public:
+	RosterIndex();
+	~RosterIndex();
+	RosterIndex(RosterIndex&&) noexcept;
+	RosterIndex& operator=(RosterIndex&&) noexcept;
+
+	void Clear();
+	// Set before anything is added; characters already built keep their values.
+	void SetTuning(TuningTable);
+	void Add(std::unique_ptr<Character>);
+	// Keeps the mapped roster alive for the entries indexed from it.
+	size_t AddSource(std::string path, std::unique_ptr<MappedFile>);
+	void AddEntry(size_t source, const RosterSpan&, const RosterPosition&);
+
+	size_t Size() const;
+	const std::string& Name(size_t i) const;
+
+	// Builds the first entry called name if it is not built yet. Null when no
+	// entry of that name can be built.
+	const Character* Build(std::string_view name);
+	// False if any entry had to be dropped.
+	bool BuildAll();
+
+	// Built entries only, so these are safe to share between batch workers.
+	const Character* Find(std::string_view name) const;
+	const Character* At(size_t i) const;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+// Where an entry of the "characters" array starts, 1-based like editors show.
+struct RosterPosition {
+	size_t index = 0;   // 0-based position in the array
+	size_t line = 1;
+	size_t column = 1;
+};
+
+// Where an entry lies in the roster text. name is the entry's "name" string
+// and is empty when it has none; size is 0 for an entry that is not an object.
+struct RosterSpan {
+	size_t offset = 0;
+	size_t size = 0;
+	std::string_view name;
+};
+
+// Scans the "characters" array of a roster through json.hpp's SAX interface
+// and reports each entry's span and name as soon as it closes. Nothing is
+// built; RosterIndex parses a span only when that character is used. A file
+// whose root object has no "characters" key is one character on its own.
+class RosterReader {
+public:
+	using EntryCallback = std::function<void(const RosterSpan&, const RosterPosition&)>;
+
+	// False on a syntax error, which stops the read; entries before it have
+	// already been delivered and error holds json.hpp's message (with its own
+	// line and column).
+	static bool Read(std::string_view text, const EntryCallback&, std::string& error);
+};
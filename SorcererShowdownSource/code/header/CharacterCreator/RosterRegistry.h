@@ -0,0 +1,71 @@
+#pragma once
+
+// Name -> factory table for the types a roster file can name. Each type
+// carries its own roster name (T::roster_name) and the table is laid out at
+// compile time as a collision-free hash over those names, so a lookup is one
+// hash and at most one string compare however many types are listed.
+template<typename Base, typename... Types>
+class RosterRegistry {
+	using Factory = std::unique_ptr<Base>(*)();
+	struct Entry {
+		std::string_view name;
+		Factory make = nullptr;
+	};
+
+	static constexpr size_t count = sizeof...(Types);
+	static constexpr size_t slots = std::bit_ceil(count * 2);
+	static constexpr std::array<std::string_view, count> names = { Types::roster_name... };
+	static constexpr std::uint32_t no_seed = 0xFFFFFFFF;
+
+	template<typename T>
+	static std::unique_ptr<Base> MakeOne() { return std::make_unique<T>(); }
+
+	static constexpr size_t Slot(std::string_view name, std::uint32_t seed) {
+		std::uint32_t h = 2166136261u ^ seed;   // FNV-1a
+		for (char c : name) {
+			h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+		}
+		return h & (slots - 1);
+	}
+
+	static consteval std::uint32_t FindSeed() {
+		for (std::uint32_t seed = 0; seed < 1 << 16; seed++) {
+			std::array<bool, slots> used{};
+			bool collides = false;
+			for (std::string_view name : names) {
+				size_t slot = Slot(name, seed);
+				if (used[slot]) { collides = true; break; }
+				used[slot] = true;
+			}
+			if (!collides) return seed;
+		}
+		return no_seed;
+	}
+
+	static constexpr std::uint32_t seed = FindSeed();
+	static_assert(seed != no_seed, "roster names must be unique");
+
+	static consteval std::array<Entry, slots> Build() {
+		std::array<Entry, slots> table{};
+		((table[Slot(Types::roster_name, seed)] = Entry{ Types::roster_name, &MakeOne<Types> }), ...);
+		return table;
+	}
+	static constexpr std::array<Entry, slots> table = Build();
+public:
+	// nullptr when no listed type has that name
+	static std::unique_ptr<Base> Make(std::string_view name) {
+		const Entry& e = table[Slot(name, seed)];
+		if (e.make && e.name == name) return e.make();
+		return nullptr;
+	}
+
+	// "a, b, c" in the order the types are listed, for error messages
+	static std::string Names() {
+		std::string out;
+		for (std::string_view name : names) {
+			if (!out.empty()) out += ", ";
+			out += name;
+		}
+		return out;
+	}
+};
@@ -0,0 +1,26 @@
+#pragma once
+class Character;
+class Technique;
+class Domain;
+
+// Replacement values for technique and domain constants, keyed by the
+// roster name of the technique or domain and then by the constant, e.g.
+// "Limitless" -> "blue_output". Applied to characters as they are built,
+// so every copy of a roster entry carries the same values and a sweep can
+// run many variants side by side in one process.
+class TuningTable {
+	struct Section {
+		std::string name;
+		std::vector<std::pair<std::string, double>> values;
+	};
+	std::vector<Section> sections;
+
+	void ApplyTo(Technique&) const;
+	void ApplyTo(Domain&) const;
+public:
+	// Replaces an earlier value for the same key.
+	void Set(std::string_view section, std::string_view key, double value);
+	bool Empty() const;
+	// Tunes a curse user's technique, domain and counter domain.
+	void Apply(Character&) const;
+};
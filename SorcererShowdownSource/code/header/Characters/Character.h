@@ -1,32 +1,67 @@
 #pragma once
 #include "code/header/CharacterCreator/AI/CharacterAI.h"
 #include "code/header/CursedTools/CursedTool.h"
+#include "code/header/GameManagement/BattleContext.h"
+#include "code/header/Characters/CharacterDefinition.h"
 struct Battlefield;
 
-class Character { 
+class Character : public ArenaAllocated { 
+public:
+	// What a fighter is and what it currently has up, packed into one word so
+	// the checks made for every attack and target are a load and a mask. Kind
+	// bits are set by the constructors, technique and domain bits by
+	// SetTechnique/SetDomain, and state bits by whatever changes that state.
+	enum Flag : std::uint16_t {
+		KindCurseUser = 1 << 0,
+		KindSorcerer = 1 << 1,
+		KindCursedSpirit = 1 << 2,
+		KindGifted = 1 << 3,
+		KindShikigami = 1 << 4,
+		HasLimitless = 1 << 5,
+		HasShrine = 1 << 6,
+		HasIdleDeathGamble = 1 << 7,
+		InfinityOn = 1 << 8,          // only for the fighter's own Limitless
+		DomainOn = 1 << 9,
+		CounterDomainOn = 1 << 10,
+		StunnedOn = 1 << 11,
+		Intangible = 1 << 12          // shikigami that is not physically manifested
+	};
 protected:
-	static int global_id_counter;
-	int unique_id;
-
-	std::string char_name = "";
-	std::string name_color = "";
-
-	double health;
-	double max_health;
-	double previous_health;
+	int unique_id = 0;
+	std::uint16_t flags = 0;
+	std::uint16_t hit_blockers = 0;   // flags that make CanBeHit false for this type
+	BattleContext* context = nullptr;
+
+	std::shared_ptr<const CharacterDefinition> definition = CharacterDefinition::Default();
+
+	// Hot stats live in the battle's FighterStats once the fighter is on a
+	// battlefield, and in own_stats before that.
+	FighterStats* stats = nullptr;
+	size_t stat_slot = 0;
+	FighterStats::Values own_stats{};
 	
 	std::unique_ptr<CursedTool> cursed_tool = nullptr;
 	std::vector<std::unique_ptr<CursedTool>> inventory_curse;
 
 	std::unique_ptr<CharacterBrain> brain = nullptr;
 
+	mutable BattleRandom rng;
+
 	int stun_duration = 3;
 
 	double base_attack_damage = 20.0;
 
 	bool is_player = false;
-	bool is_stunned = false;
 	bool is_invulnerable = false;
+
+	void RecordDamage(BattleEvent::DamageKind, double health_before);
+	void TrackHealth(double health_before);
+
+	double& Stat(HotStat s) { return stats ? stats->At(s, stat_slot) : own_stats[static_cast<size_t>(s)]; }
+	double Stat(HotStat s) const { return stats ? stats->At(s, stat_slot) : own_stats[static_cast<size_t>(s)]; }
+
+	CharacterDefinition& EditDefinition();
+	void SetFlag(Flag f, bool on) { flags = on ? (flags | f) : (flags & ~f); }
 public:
 	Character(double hp);
 
@@ -41,6 +76,8 @@ public:
 
 	void SetHealth(double h);
 	void SetCharacterName(std::string name, std::string color);
+	const CharacterDefinition& Definition() const;
+	void ShareDefinition(const Character& entry);
 
 	bool IsThePlayer() const;
 	void SetAsPlayer(bool);
@@ -77,22 +114,33 @@ public:
 
 	int GetID() const;
 	std::string GetNameWithID() const;
-	static void ResetGlobalID() { global_id_counter = 0; }
-	static void AddGlobalID(int i) { global_id_counter += i; }
+	ScratchString GetNameWithID(std::pmr::memory_resource*) const;
+
+	std::uint16_t Flags() const { return flags; }
+	bool HasFlag(Flag f) const { return flags & f; }
 
-	virtual bool IsaCurseUser() const;
-	virtual bool IsaCursedSpirit() const;
-	virtual bool IsaSorcerer() const;
-	virtual bool IsPhysicallyGifted() const;
-	virtual bool IsShikigami() const;
+	bool IsaCurseUser() const { return flags & KindCurseUser; }
+	bool IsaCursedSpirit() const { return flags & KindCursedSpirit; }
+	bool IsaSorcerer() const { return flags & KindSorcerer; }
+	bool IsPhysicallyGifted() const { return flags & KindGifted; }
+	bool IsShikigami() const { return flags & KindShikigami; }
+	bool InfinityActive() const { return flags & InfinityOn; }
 
 	std::string GetSimpleName() const;
 	std::string GetName() const;
 
-	virtual bool CanBeHit() const;
+	bool CanBeHit() const { return !(flags & hit_blockers); }
 
-	void AssignID();
+	void JoinBattle(BattleContext&);
 	virtual bool CanBeAssignedID() const;
+	BattleContext* GetContext() const;
+	void AttachStats(FighterStats&);
+	size_t GetStatSlot() const;
+	void SetStatSlot(size_t);
+	BattleRandom& GetRandom() const;
+	OutputSink& Out() const;
+	std::pmr::memory_resource* Scratch() const;
+	void RecordEvent(const BattleEvent&) const;
 	double GetBaseAttackDamage() const;
 	void AddToolToInventory(std::unique_ptr<CursedTool>);
 
@@ -0,0 +1,28 @@
+#pragma once
+
+// The part of a fighter that every copy of the same roster entry shares and
+// that never changes during a battle: its name, the coloured label narration
+// prints, and the curse user limits. Clones point at their entry's definition
+// instead of copying it, and the named characters share one static definition
+// per type. Anything that does change a definition (mostly the JSON loader)
+// goes through Character::EditDefinition, which copies it first if it is shared.
+struct CharacterDefinition {
+	std::string name{};
+	std::string color{};
+	std::string label{};                // color + name + reset, rendered by Make/RenderLabel
+
+	int black_flash_chance = 5;
+	double blackflash_mult = 4.5;
+	int domain_limit = 5;
+	int max_zone_time = 3;
+	int max_domain_time = 5;
+	int max_counter_time = 3;
+	int max_counter_cooldown = 2;
+	int max_technique_burnout_time = 4;
+	bool six_eyes = false;
+
+	void RenderLabel();
+
+	static std::shared_ptr<const CharacterDefinition> Make(CharacterDefinition);
+	static const std::shared_ptr<const CharacterDefinition>& Default();
+};
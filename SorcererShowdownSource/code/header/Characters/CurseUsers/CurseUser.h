@@ -13,16 +13,9 @@ protected:
 	std::unique_ptr<Specials> special = nullptr;
 	std::vector<std::unique_ptr<Shikigami>> shikigami;
 
-	double cursed_energy;
-	double max_cursed_energy;
-	double prev_cursed_energy;
-
-	double ce_regen;
 	double saved_ce_regen;
 
 	bool domain_amplification_active = false;
-	bool counter_domain_active = false;
-	bool domain_active = false;
 	bool is_strained = false;
 	bool counter_on_cooldown = false;
 	bool zone_ce_boost = false;
@@ -37,21 +30,18 @@ protected:
 
 	int counter_recover_time = 0;
 
-	int black_flash_chance = 5;  
 	int the_zone_time = 0;
-	int max_zone_time = 3;
-
-	double blackflash_mult = 4.5;
 	int blackflash_chain = 0;
 
-	double current_ce_reinforcement;
-	double max_ce_reinforcement;
-
-	int domain_limit = 5;
-	int max_counter_time = 3;
-	int max_counter_cooldown = 2;
-	int max_domain_time = 5;
-	int max_technique_burnout_time = 4;
+	void RecordCESpent(double ce_before);
+	// Tag for the named characters' bare constructors, which set up
+	// everything but the technique, domains and special. Clone builds bare
+	// and then calls CloneLoadoutFrom, so no default loadout is allocated
+	// only to be replaced.
+	struct BareLoadout {};
+	// Takes the roster entry's technique, domains and special, so tuning
+	// applied to the entry reaches every copy.
+	void CloneLoadoutFrom(const CurseUser& entry);
 public:
     CurseUser(double hp, double ce, double regen);
     virtual ~CurseUser();
@@ -126,8 +116,9 @@ public:
 	double GetBlackflashMult() const;
 	void SetBlackflashChance(int);
 
-	bool IsaCurseUser() const override;
-	bool CanBeHit() const override;
+	// Re-reads the technique's kind and Infinity into the flags; Limitless
+	// calls this whenever it turns Infinity on or off.
+	void SyncTechniqueFlags();
 
 	bool IsStrained() const;
 
@@ -6,4 +6,6 @@ public:
 	Mahito();
 	std::unique_ptr<Character> Clone() const override;
 	void OnCharacterTurn(Battlefield&) override;
+private:
+	explicit Mahito(BareLoadout);
 };
\ No newline at end of file
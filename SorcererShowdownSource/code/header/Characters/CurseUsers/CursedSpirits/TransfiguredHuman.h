@@ -3,7 +3,7 @@
 
 class TransfiguredHuman : public CursedSpirit {
 public:
-	TransfiguredHuman();
+	explicit TransfiguredHuman(BattleRandom& battle_rng);
 	void OnCharacterTurn(Battlefield&) override;
 	bool IsTransfigured() const override;
 };
\ No newline at end of file
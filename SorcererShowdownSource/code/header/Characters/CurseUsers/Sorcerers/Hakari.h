@@ -9,4 +9,6 @@ public:
 	std::unique_ptr<Character> Clone() const override;
 	void OnCharacterTurn(Battlefield&) override;
 	void TickCharacterSpecialty() override;
+private:
+	explicit Hakari(BareLoadout);
 };
\ No newline at end of file
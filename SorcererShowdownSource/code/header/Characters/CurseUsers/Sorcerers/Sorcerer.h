@@ -8,7 +8,6 @@ class Specials;
 
 class Sorcerer : public CurseUser {
 protected:
-	bool six_eyes = false;
 	enum class ReverseCT {
 		Disabled, Active, Overdrive
 	};
@@ -42,7 +41,4 @@ public:
 	double GetRCTHeal() const;
 	double GetRCTCost() const;
 	RCTProficiency GetRCTProficiency() const;
-
-	bool IsaSorcerer() const override;
-	bool CanBeHit() const override;
 };
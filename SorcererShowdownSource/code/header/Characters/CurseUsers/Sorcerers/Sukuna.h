@@ -6,4 +6,6 @@ public:
 	Sukuna();
 	std::unique_ptr<Character> Clone() const override;
 	void OnCharacterTurn(Battlefield&) override;
+private:
+	explicit Sukuna(BareLoadout);
 };
@@ -7,4 +7,6 @@ public:
 	std::unique_ptr<Character> Clone() const override;
 	void OnCharacterTurn(Battlefield&) override;
 	bool InfCheck(Character*);
+private:
+	explicit Yuta(BareLoadout);
 };
\ No newline at end of file
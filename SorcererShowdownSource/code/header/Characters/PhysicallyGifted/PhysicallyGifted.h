@@ -12,12 +12,10 @@ public:
 	std::unique_ptr<Character> Clone() const override;
 
 	void Attack(Character*) override;
-	void TickCharacterSpecialty() override;
 
 	void SetStrength(double);
 	double GetStrength() const;
 	double GetStrengthDamage()const;
 	double GetDamageReinforcement()const override;
 	double GetHealingFactor()const;
-	bool IsPhysicallyGifted() const override;
 };
\ No newline at end of file
@@ -6,6 +6,7 @@ struct Battlefield;
 
 class Agito : public Shikigami {
 public:
+	static constexpr std::string_view roster_name = "Agito";
 	Agito();
 protected:
 	const double passive_heal_amount = 50.0;
@@ -6,6 +6,7 @@ struct Battlefield;
 
 class Mahoraga : public Shikigami {
 public:
+	static constexpr std::string_view roster_name = "Mahoraga";
 	Mahoraga();
 protected:
 	const double keep_active_cost = 120.0;
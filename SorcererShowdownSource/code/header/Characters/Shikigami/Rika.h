@@ -17,6 +17,7 @@ private:
 	static constexpr int max_active_time = 5;
 	int active_cooldown = 5;
 public:
+	static constexpr std::string_view roster_name = "Rika";
 	Rika();
 	void OnShikigamiTurn(CurseUser* user, Battlefield& bf) override;
 	void SaveUserCursedEnergy(CurseUser*);
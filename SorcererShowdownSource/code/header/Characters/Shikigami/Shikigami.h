@@ -31,9 +31,6 @@ public:
 	bool IsActivePhysically() const;	
 	std::string GetShikigamiStatus() const;
 
-	bool IsShikigami() const override;
-	bool CanBeHit() const override;
-
 	virtual bool IsMahoraga() const;
 	virtual bool IsAgito() const;
 };
\ No newline at end of file
@@ -1,9 +1,15 @@
 #pragma once
+#include "code/header/GameManagement/BattleArena.h"
 class Sorcerer;
 class Character;
 
-class CursedTool {
+class CursedTool : public ArenaAllocated {
+public:
+	// Every cursed tool in the game, each a final class. Anything else stays
+	// Other and is reached through the vtable.
+	enum class Kind : std::uint8_t { Other, InvertedSpearOfHeaven, Katana, PlayfulCloud, SplitSoulKatana };
 protected:
+	Kind kind = Kind::Other;
 	std::string name = "";
 	std::string color = "";
 	double base_damage = 10.0;
@@ -11,6 +17,11 @@ public:
 	virtual ~CursedTool() = default;
 	virtual std::unique_ptr<CursedTool> Clone() const = 0;
 	virtual void UseTool(Character*, Character*) = 0;
+	Kind GetKind() const;
+	// UseTool through a switch on kind, calling the final class directly.
+	void DispatchUse(Character* user, Character* target);
+	// Whether kind names this object's dynamic class; asserted in debug builds.
+	bool KindMatchesType() const;
 	std::string GetName() const;
 	std::string GetSimpleName() const;
 
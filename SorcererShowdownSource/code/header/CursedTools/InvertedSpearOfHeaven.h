@@ -1,8 +1,9 @@
 #pragma once
 #include "code/header/CursedTools/CursedTool.h"
 
-class InvertedSpearofHeaven : public CursedTool {
+class InvertedSpearofHeaven final : public CursedTool {
 public:
+	static constexpr std::string_view roster_name = "The Inverted Spear of Heaven";
 	InvertedSpearofHeaven();
 	std::unique_ptr<CursedTool> Clone() const override;
 	void UseTool(Character*, Character*) override;
@@ -1,8 +1,9 @@
 #pragma once
 #include "code/header/CursedTools/CursedTool.h"
 
-class Katana : public CursedTool {
+class Katana final : public CursedTool {
 public:
+	static constexpr std::string_view roster_name = "Katana";
 	Katana();
 	std::unique_ptr<CursedTool> Clone() const override;
 	void UseTool(Character*, Character*) override;
@@ -1,8 +1,9 @@
 #pragma once
 #include "code/header/CursedTools/CursedTool.h"
 
-class PlayfulCloud : public CursedTool {
+class PlayfulCloud final : public CursedTool {
 public:
+	static constexpr std::string_view roster_name = "Playful Cloud";
 	PlayfulCloud();
 	std::unique_ptr<CursedTool> Clone() const override;
 	void UseTool(Character*, Character*) override;
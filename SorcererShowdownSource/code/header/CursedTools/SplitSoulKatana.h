@@ -1,8 +1,9 @@
 #pragma once
 #include "code/header/CursedTools/CursedTool.h"
 
-class SplitSoulKatana : public CursedTool {
+class SplitSoulKatana final : public CursedTool {
 public:
+	static constexpr std::string_view roster_name = "Split Soul Katana";
 	SplitSoulKatana();
 	std::unique_ptr<CursedTool> Clone() const override;
 	void UseTool(Character*, Character*) override;
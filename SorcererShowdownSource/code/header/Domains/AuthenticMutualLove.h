@@ -4,8 +4,9 @@
 class CurseUser;
 class Character;
 
-class AuthenticMutualLove : public Domain {
+class AuthenticMutualLove final : public Domain {
 public:
+	static constexpr std::string_view roster_name = "Authentic Mutual Love";
 	AuthenticMutualLove();
 	std::unique_ptr<Domain> Clone() const override;
 	void OnSureHit(CurseUser& user, Character& target) override;
@@ -1,16 +1,25 @@
 #pragma once
+#include "code/header/GameManagement/BattleArena.h"
 class Character;
 class CurseUser;
 
-class Domain {
+class Domain : public ArenaAllocated {
+public:
+	// Every domain in the game, each a final class. Anything else stays
+	// Other and is reached through the vtable.
+	enum class Kind : std::uint8_t {
+		Other, AuthenticMutualLove, HollowWickerBasket, IdleDeathGamble, InfiniteVoid,
+		MalevolentShrine, SelfEmbodimentOfPerfection, SimpleDomain
+	};
 protected:
+	Kind kind = Kind::Other;
 	std::string name = "";
 	std::string color = "";
 
 	double domain_health;
-	const double base_health;
+	double base_health;
 	double domain_overwhelm_strength;
-	const double base_range;
+	double base_range;
 	double current_range;
 	bool clashing = false;
 	bool is_neutralizer = false;
@@ -34,6 +43,17 @@ public:
 	void SetClashState(bool a);
 	double DomainRangeMult()const;
 	virtual void OnSureHit(CurseUser& user, Character& target);
+	Kind GetKind() const;
+	// The name rosters and tuning tables know this domain by.
+	std::string_view RosterName() const;
+	// Sets health, strength, range, domain_cost or surehit_damage; false for
+	// any other key and for a constant this kind of domain never reads
+	// (surehit_damage on Idle Death Gamble, anything on a neutralizer).
+	bool Tune(std::string_view key, double value);
+	// OnSureHit through a switch on kind, calling the final class directly.
+	void DispatchSureHit(CurseUser& user, Character& target);
+	// Whether kind names this object's dynamic class; asserted in debug builds.
+	bool KindMatchesType() const;
 	std::string GetDomainName() const;
 	double GetUseCost() const;
 
@@ -4,8 +4,9 @@
 class CurseUser;
 class Character;
 
-class HollowWickerBasket : public Domain {
+class HollowWickerBasket final : public Domain {
 public:
+	static constexpr std::string_view roster_name = "Hollow Wicker Basket";
 	HollowWickerBasket();
 	std::unique_ptr<Domain> Clone() const override;
 };
\ No newline at end of file
@@ -3,16 +3,18 @@
 
 class CurseUser;
 class Character;
+class OutputSink;
 
-class IdleDeathGamble : public Domain {
+class IdleDeathGamble final : public Domain {
 protected:
 	int luck = 7;
 	bool jackpot = false, info_dumped = false;
 public:
+	static constexpr std::string_view roster_name = "Idle Death Gamble";
 	IdleDeathGamble();
 	std::unique_ptr<Domain> Clone() const override;
 	bool HasHitJackpot() const;
-	void DumpInfo();
+	void DumpInfo(OutputSink& out);
 	void SetJackpot(bool);
 	void OnSureHit(CurseUser& user, Character& target) override;
 	bool IsIdleDeathGamble()const override;
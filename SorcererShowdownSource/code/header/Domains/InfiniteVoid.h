@@ -4,8 +4,9 @@
 class CurseUser;
 class Character;
 
-class InfiniteVoid : public Domain {
+class InfiniteVoid final : public Domain {
 public:
+	static constexpr std::string_view roster_name = "Infinite Void";
 	InfiniteVoid();
 	std::unique_ptr<Domain> Clone() const override;
 	void OnSureHit(CurseUser& user, Character& target) override;
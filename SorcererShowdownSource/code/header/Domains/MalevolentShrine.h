@@ -4,8 +4,9 @@
 class CurseUser;
 class Character;
 
-class MalevolentShrine : public Domain {
+class MalevolentShrine final : public Domain {
 public:
+	static constexpr std::string_view roster_name = "Malevolent Shrine";
 	MalevolentShrine();
 	std::unique_ptr<Domain> Clone() const override;
 	void OnSureHit(CurseUser& user, Character& target) override;
@@ -4,8 +4,9 @@
 class CurseUser;
 class Character;
 
-class SelfEmbodimentOfPerfection : public Domain {
+class SelfEmbodimentOfPerfection final : public Domain {
 public:
+	static constexpr std::string_view roster_name = "Self Embodiment of Perfection";
 	SelfEmbodimentOfPerfection();
 	std::unique_ptr<Domain> Clone() const override;
 	void OnSureHit(CurseUser& user, Character& target) override;
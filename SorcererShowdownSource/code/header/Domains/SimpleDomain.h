@@ -4,8 +4,9 @@
 class CurseUser;
 class Character;
 
-class SimpleDomain : public Domain {
+class SimpleDomain final : public Domain {
 public:
+	static constexpr std::string_view roster_name = "Simple Domain";
 	SimpleDomain();
 	std::unique_ptr<Domain> Clone() const override;
 };
\ No newline at end of file
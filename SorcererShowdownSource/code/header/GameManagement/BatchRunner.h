@@ -0,0 +1,77 @@
+#pragma once
+struct Battlefield;
+struct BattleCreator;
+class Character;
+class BattleManager;
+class OutputSink;
+class MemorySink;
+class EventStream;
+
+struct BatchOptions {
+	std::string roster_path = "";
+	std::string tuning_path = "";
+	std::string log_path = "";
+	std::string events_path = "";
+	std::string output_path = "";
+	std::string format = "csv";
+	std::vector<std::pair<std::string, int>> fighters;
+	int battles = 1;
+	int turn_cap = 500;
+	int threads = 1;
+	bool seeded = false;
+	std::uint64_t seed = 0;
+	bool matrix = false;
+};
+
+struct BattleResult {
+	enum class Outcome { Win, Draw, TurnCap };
+	Outcome outcome = Outcome::Draw;
+	std::uint64_t seed = 0;
+	std::string winner = "";
+	int winner_id = 0;
+	double winner_health = 0.0;
+	int rounds = 0;
+	int turns = 0;
+};
+
+// Optional instrumentation for RunBattle, only the benchmark pays for the clock reads.
+struct BattleTiming {
+	std::chrono::nanoseconds decision_time{ 0 };
+	long long decisions = 0;
+};
+
+struct alignas(64) BatchTally {
+	std::map<std::string, int> wins;
+	int battles = 0;
+	int draws = 0;
+	int turn_caps = 0;
+	long long rounds = 0;
+
+	void Add(const BattleResult&);
+	void Merge(const BatchTally&);
+};
+
+class BatchRunner {
+	OutputSink* log = nullptr;
+	OutputSink* event_log = nullptr;
+	std::mutex log_mutex;
+public:
+	static bool IsBatchRequest(int argc, char* argv[]);
+	static bool ParseArgs(int argc, char* argv[], BatchOptions&);
+	static void PrintUsage();
+	int Run(const BatchOptions&);
+
+	static void LoadRoster(BattleCreator&, const BatchOptions&);
+	static const Character* FindRosterEntry(const BattleCreator&, const std::string& name);
+	static void AddFighter(Battlefield&, const Character& entry);
+	static BattleResult RunBattle(Battlefield&, BattleTiming* timing = nullptr);
+	static bool PlayRound(Battlefield&, BattleManager&, BattleResult&, BattleTiming* timing = nullptr);
+	static int ThreadCount(const BatchOptions&, std::int64_t jobs);
+private:
+	void RunWorker(const BattleCreator&, const BatchOptions&, std::atomic<int>& next_battle, std::vector<BattleResult>&, BatchTally&);
+	void PopulateBattlefield(Battlefield&, const BattleCreator&, const BatchOptions&);
+	void WriteTranscript(int battle, std::uint64_t seed, const MemorySink&);
+	void WriteEvents(int battle, const EventStream&);
+	static void PrintResult(int battle, const BattleResult&);
+	static void PrintSummary(const BatchTally&, int threads, std::uint64_t seed, double seconds);
+};
@@ -0,0 +1,46 @@
+#pragma once
+
+// Monotonic memory for everything a battle is assembled from: fighters,
+// techniques, domains, specials, tools, shikigami and brains. While a Scope
+// is open on a thread, their operator new bumps from that thread's arena and
+// delete is a no-op; the whole battle is released when the arena (the first
+// member of Battlefield, so the last one destroyed) goes away. Objects made
+// with no scope open come from the global heap as usual, and every block
+// remembers which of the two it came from, so either kind can be deleted
+// anywhere.
+class BattleArena {
+	std::pmr::monotonic_buffer_resource resource;
+	size_t bytes_used = 0;
+	size_t allocations = 0;
+
+	static thread_local BattleArena* current;
+public:
+	struct Stats {
+		size_t bytes_used = 0;
+		size_t allocations = 0;
+	};
+
+	BattleArena();
+	BattleArena(const BattleArena&) = delete;
+	BattleArena& operator=(const BattleArena&) = delete;
+
+	Stats GetStats() const;
+
+	class Scope {
+		BattleArena* previous;
+	public:
+		explicit Scope(BattleArena&);
+		~Scope();
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+	};
+
+	static void* Allocate(size_t size);
+	static void Free(void* p) noexcept;
+};
+
+// Base for the battle object hierarchies so their new/delete go through BattleArena.
+struct ArenaAllocated {
+	static void* operator new(size_t size) { return BattleArena::Allocate(size); }
+	static void operator delete(void* p) noexcept { BattleArena::Free(p); }
+};
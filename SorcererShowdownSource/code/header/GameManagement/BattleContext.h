@@ -0,0 +1,69 @@
+#pragma once
+#include "code/header/GameManagement/BattleRandom.h"
+#include "code/header/GameManagement/OutputSink.h"
+#include "code/header/GameManagement/BattleEvents.h"
+#include "code/header/GameManagement/BattlefieldIndex.h"
+#include "code/header/GameManagement/ThreatBoard.h"
+#include "code/header/GameManagement/FighterStats.h"
+#include "code/header/GameManagement/TurnScratch.h"
+class Character;
+
+struct BattleConfig {
+	int turn_cap = 0;
+	bool spectator_mode = false;
+};
+
+class BattleContext {
+	BattleRandom rng;
+	BattleConfig config;
+	int issued_ids = 0;
+	std::unique_ptr<OutputSink> owned_sink;
+	OutputSink* sink = &OutputSink::Stdout();
+	EventStream events;
+	BattlefieldIndex index;
+	ThreatBoard threats;
+	FighterStats stats;
+	TurnScratch scratch;
+public:
+	BattleContext();
+	explicit BattleContext(std::uint64_t seed);
+	BattleContext(const BattleContext&) = delete;
+	BattleContext& operator=(const BattleContext&) = delete;
+
+	int NextID();
+	void ResetIDs(int issued = 0);
+	int IssuedIDs() const;
+
+	void Reseed(std::uint64_t seed);
+	std::uint64_t GetSeed() const;
+	BattleRandom& Random();
+	BattleRandom CharacterStream(int id) const;
+
+	BattleConfig& Config();
+	const BattleConfig& Config() const;
+
+	void SetSink(std::unique_ptr<OutputSink>);
+	void SetSink(OutputSink&);
+	OutputSink& Out() const;
+
+	EventStream& Events();
+	const EventStream& Events() const;
+
+	BattlefieldIndex& Index();
+	const BattlefieldIndex& Index() const;
+	ThreatBoard& Threats();
+	// A fighter's domain, Infinity or technique flags changed mid round.
+	void TraitsChanged(const Character&);
+	FighterStats& Stats();
+	TurnScratch& Scratch();
+
+	// Start of a round: advances the event round and retires the threat rolls.
+	void BeginRound();
+	// Start of a fighter's turn: clears the turn scratch and tags events with the fighter.
+	void BeginTurn(int id);
+
+	// Battlefield membership: Enlist after pushing a fighter onto the battlefield,
+	// Reindex after removing any.
+	void Enlist(Character&, size_t slot);
+	void Reindex(const std::vector<std::unique_ptr<Character>>& battlefield);
+};
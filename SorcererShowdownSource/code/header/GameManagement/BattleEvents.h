@@ -0,0 +1,41 @@
+#pragma once
+
+struct BattleEvent {
+	enum class Type : std::uint8_t { Damage, Heal, CESpent, DomainActivated, DomainClash, DomainCollapsed, BlackFlash, Spawn, Removed };
+	enum class DamageKind : std::uint8_t { None, Normal, Bypass, BypassReinforcement, BypassAll };
+
+	Type type = Type::Damage;
+	DamageKind damage = DamageKind::None;
+	int round = 0;
+	int source = 0; // 0 when the battle itself is the cause (end of turn ticks, spawns)
+	int target = 0;
+	int detail = 0; // black flash chain length, domain use count
+	double amount = 0.0;
+
+	static std::string_view TypeName(Type);
+	static std::string_view DamageKindName(DamageKind);
+};
+
+// Append-only per-battle event log. Nothing is stored or dispatched unless
+// recording is on or someone subscribed, so emit sites check Listening() first.
+class EventStream {
+	std::vector<BattleEvent> events;
+	std::vector<std::pair<int, std::function<void(const BattleEvent&)>>> subscribers;
+	int next_subscriber = 0;
+	bool recording = false;
+	int round = 0;
+	int actor = 0;
+public:
+	bool Listening() const { return recording || !subscribers.empty(); }
+	void Emit(BattleEvent);
+
+	void Record(bool);
+	int Subscribe(std::function<void(const BattleEvent&)>);
+	void Unsubscribe(int);
+	std::span<const BattleEvent> Events() const;
+
+	void BeginRound();
+	void BeginTurn(int actor_id);
+	int Round() const;
+	int Actor() const;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+// Philox4x32-10 counter-based generator. The key is the battle seed and the
+// upper half of the counter selects the stream, so the battle and every
+// fighter can draw independently from the same seed.
+class BattleRandom {
+	std::uint64_t seed = 0;
+	std::uint64_t stream = 0;
+	std::uint64_t block = 0;
+	std::array<std::uint32_t, 4> buffer{};
+	size_t buffered = 0;
+
+	std::array<std::uint32_t, 4> GenerateBlock(std::uint64_t index) const;
+	std::uint32_t NextWord();
+	std::uint32_t NextBelow(std::uint32_t range, std::uint32_t threshold);
+public:
+	BattleRandom() = default;
+	explicit BattleRandom(std::uint64_t seed, std::uint64_t stream = 0);
+
+	void Reseed(std::uint64_t new_seed);
+	std::uint64_t GetSeed() const;
+	std::uint64_t GetStream() const;
+	BattleRandom Stream(std::uint64_t id) const;
+
+	int Next(int min, int max);
+	bool Chance(int chance, int out_of);
+
+	void FillBounded(std::span<int> out, int min, int max);
+	void FillBernoulli(std::span<std::uint8_t> out, int chance, int out_of);
+	// count draws in [min, max], kept in memory (normally the turn scratch)
+	std::pmr::vector<int> Batch(size_t count, int min, int max, std::pmr::memory_resource* memory);
+
+	static std::uint64_t RandomSeed();
+	// One Philox4x32-10 block, as in Random123; checked by BattleRandomTest.
+	static std::array<std::uint32_t, 4> Philox(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key);
+};
@@ -1,13 +1,22 @@
 #pragma once
+#include "code/header/GameManagement/BattleArena.h"
+#include "code/header/GameManagement/BattleContext.h"
+#include "code/header/GameManagement/SpawnPool.h"
+#include "code/header/CharacterCreator/RosterIndex.h"
 class Character;
 class CurseUser;
 
 struct Battlefield {
+	BattleArena arena; // first, so it outlives everything allocated from it
+	BattleContext context;
 	std::vector<std::unique_ptr<Character>> battlefield;
-	std::vector<std::unique_ptr<Character>> spawn_queue;
+	SpawnPool spawns;
 	std::vector<CurseUser*> active_domains;
 };
 struct BattleCreator{
 	std::map<std::string, int> fighter_counts;
-	std::vector<std::unique_ptr<Character>> characterlist;
+	RosterIndex characterlist;
+	std::string roster_path = "characters.json";
+	std::string tuning_path = "tuning.json";
+	bool interactive = true;
 };
\ No newline at end of file
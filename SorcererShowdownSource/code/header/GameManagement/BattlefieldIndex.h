@@ -0,0 +1,39 @@
+#pragma once
+class Character;
+class CurseUser;
+
+// Lookups over the battlefield that are kept up to date as fighters join,
+// take damage, heal and expand or collapse domains, so end of game checks
+// and domain counts no longer walk every fighter each turn. Only fighters
+// with an ID are tracked (shikigami and roster entries are not members).
+// Removing fighters reorders the battlefield, so that path calls Rebuild.
+class BattlefieldIndex {
+	std::vector<Character*> members;        // battlefield order
+	std::vector<Character*> by_id;          // ID -> fighter, nullptr when not on the battlefield
+	std::vector<int> slot_of;               // ID -> position in Battlefield::battlefield, -1 when absent
+	std::vector<CurseUser*> curse_users;    // battlefield order
+	std::vector<CurseUser*> active_domains; // ID order, which is battlefield order
+	int alive = 0;
+	int player_id = 0;
+	unsigned generation = 0;                // bumped whenever membership changes
+
+	bool Contains(const Character*) const;
+public:
+	void Add(Character*, size_t slot);
+	void Rebuild(const std::vector<std::unique_ptr<Character>>&);
+
+	void HealthChanged(const Character*, bool now_alive);
+	void DomainChanged(CurseUser*, bool now_active);
+	void SetPlayer(const Character*, bool is_player);
+
+	int AliveCount() const;
+	bool PlayerAlive() const;
+	Character* Player() const;
+	Character* Find(int id) const;
+	int SlotOf(int id) const;
+	std::span<Character* const> Members() const;
+	unsigned Generation() const;
+	std::span<CurseUser* const> CurseUsers() const;
+	std::span<CurseUser* const> ActiveDomains() const;
+	int OtherActiveDomains(const CurseUser*) const;
+};
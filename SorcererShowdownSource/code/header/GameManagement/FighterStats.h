@@ -0,0 +1,41 @@
+#pragma once
+
+// The numbers the end of turn upkeep touches for every fighter.
+enum class HotStat : std::uint8_t {
+	Health,
+	MaxHealth,
+	PreviousHealth,
+	CursedEnergy,
+	MaxCursedEnergy,
+	PreviousCE,
+	CERegen,
+	Reinforcement,
+	MaxReinforcement,
+	PassiveRegen,     // health regained every turn (cursed spirits, physically gifted)
+	Regenerates,      // 1 for the kinds that apply PassiveRegen, 0 for everyone else
+	Count
+};
+inline constexpr size_t HotStatCount = static_cast<size_t>(HotStat::Count);
+
+// Structure-of-arrays storage for the hot stats of everyone on a battlefield,
+// one column per stat and one slot per fighter in battlefield order. Fighters
+// that are not on a battlefield keep the same values in their own array (see
+// Character::Stat). Stats a fighter does not have (CE for the physically
+// gifted) stay at 0, which keeps the batch upkeep below branch free.
+class FighterStats {
+	std::array<std::vector<double>, HotStatCount> columns;
+public:
+	using Values = std::array<double, HotStatCount>;
+
+	size_t Add(const Values&);
+	void Compact(std::span<const size_t> kept);
+	size_t Size() const;
+
+	double& At(HotStat stat, size_t slot) { return columns[static_cast<size_t>(stat)][slot]; }
+	double At(HotStat stat, size_t slot) const { return columns[static_cast<size_t>(stat)][slot]; }
+	std::span<const double> Column(HotStat) const;
+
+	void RegenCE();
+	void RegenHealth();
+	void SnapshotPrevious();
+};
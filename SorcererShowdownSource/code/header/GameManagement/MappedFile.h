@@ -0,0 +1,18 @@
+#pragma once
+
+// Read-only view of a whole file, memory mapped so large rosters are paged
+// in by the OS instead of being copied into a buffer first. An empty file
+// opens fine and gives an empty view.
+class MappedFile {
+	const char* data = nullptr;
+	size_t size = 0;
+	bool open = false;
+public:
+	explicit MappedFile(const std::filesystem::path&);
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool IsOpen() const;
+	std::string_view View() const;
+};
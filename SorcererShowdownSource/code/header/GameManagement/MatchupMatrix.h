@@ -0,0 +1,44 @@
+#pragma once
+#include "code/header/GameManagement/BatchRunner.h"
+class Character;
+
+// One side of a matchup, seen from the row fighter. Turn cap and mutual
+// wipe outs count as draws, as does a win by anything other than the two
+// original fighters (e.g. a leftover Transfigured Human).
+struct MatchupCell {
+	int battles = 0;
+	int wins = 0;
+	int draws = 0;
+	int losses = 0;
+	int turn_caps = 0;
+	long long rounds = 0;
+	double win_health = 0.0;
+	double loss_health = 0.0; // the column fighter's health when it won, so the cell can be mirrored
+
+	void Add(const BattleResult&, int row_id, int col_id);
+	void Merge(const MatchupCell&);
+	// The same battles seen from the column fighter.
+	MatchupCell Mirrored() const;
+	double Rate(int count) const;
+	double MeanRounds() const;
+	double MeanWinHealth() const;
+};
+
+struct ConfidenceInterval {
+	double low = 0.0;
+	double high = 0.0;
+};
+
+class MatchupMatrix {
+	std::vector<const Character*> entries;
+	std::vector<MatchupCell> cells; // one per unordered pair, row <= col, row major
+public:
+	int Run(const BatchOptions&);
+	static ConfidenceInterval WilsonInterval(int successes, int trials);
+private:
+	size_t PairIndex(size_t row, size_t col) const;
+	MatchupCell Cell(size_t row, size_t col) const;
+	void Play(const BatchOptions&, int threads);
+	std::string FormatCsv() const;
+	std::string FormatJson(const BatchOptions&) const;
+};
@@ -0,0 +1,51 @@
+#pragma once
+
+// Narration goes through NARRATE so a disabled sink skips the whole
+// argument list, including GetNameWithID() and the std::format call.
+#define NARRATE(sink, ...) \
+	do { \
+		OutputSink& narrate_sink_ = (sink); \
+		if (narrate_sink_.Enabled()) narrate_sink_.Line(__VA_ARGS__); \
+	} while (0)
+
+class OutputSink {
+public:
+	virtual ~OutputSink() = default;
+	virtual bool Enabled() const;
+	virtual void Write(std::string_view line) = 0;
+
+	template<typename... Args>
+	void Line(std::format_string<Args...> fmt, Args&&... args) {
+		Write(std::format(fmt, std::forward<Args>(args)...));
+	}
+
+	static OutputSink& Stdout();
+};
+
+class StdoutSink : public OutputSink {
+public:
+	void Write(std::string_view line) override;
+};
+
+class FileSink : public OutputSink {
+	std::ofstream file;
+	std::mutex file_mutex;
+public:
+	explicit FileSink(const std::filesystem::path& path);
+	bool IsOpen() const;
+	void Write(std::string_view line) override;
+};
+
+class MemorySink : public OutputSink {
+	std::string buffer;
+public:
+	void Write(std::string_view line) override;
+	const std::string& Contents() const;
+	void Clear();
+};
+
+class NullSink : public OutputSink {
+public:
+	bool Enabled() const override;
+	void Write(std::string_view) override;
+};
@@ -0,0 +1,62 @@
+#pragma once
+class Character;
+
+// Units summoned mid battle. SpawnBatch queues them for the end of the round,
+// when BattleManager::SpawnNewFighters moves them onto the battlefield. A
+// summon that dies is destroyed when it is parked, but its storage is kept,
+// so the next batch of the same type is built in it. A swarm battle then
+// keeps cycling the same few arena blocks instead of taking new ones for
+// every unit. No more storage is kept than the largest batch ever asked for.
+class SpawnPool {
+	struct Storage {
+		void* bytes;
+		std::type_index type;
+	};
+
+	std::vector<std::unique_ptr<Character>> pending;
+	std::vector<Storage> spare;
+	std::vector<std::type_index> kinds;
+	size_t largest_batch = 0;
+
+	void* Reclaim(const std::type_info&);
+	void Queue(Character*);
+public:
+	SpawnPool() = default;
+	SpawnPool(const SpawnPool&) = delete;
+	SpawnPool& operator=(const SpawnPool&) = delete;
+	~SpawnPool();
+
+	// count fresh Ts built from args, in queue order, so anything the
+	// constructor draws from a random stream is drawn in the same order. A
+	// reclaimed body whose constructor throws has its storage freed the way
+	// new T would have.
+	template<typename T, typename... Args>
+	void SpawnBatch(int count, Args&&... args) {
+		if (count <= 0) return;
+		if (std::ranges::find(kinds, std::type_index(typeid(T))) == kinds.end()) kinds.emplace_back(typeid(T));
+		largest_batch = std::max(largest_batch, static_cast<size_t>(count));
+		pending.reserve(pending.size() + static_cast<size_t>(count));
+		for (int i = 0; i < count; i++) {
+			void* storage = Reclaim(typeid(T));
+			if (!storage) {
+				Queue(new T(args...));
+				continue;
+			}
+			try {
+				Queue(std::construct_at(static_cast<T*>(storage), args...));
+			}
+			catch (...) {
+				T::operator delete(storage);
+				throw;
+			}
+		}
+	}
+
+	std::span<std::unique_ptr<Character>> Pending();
+	void ClearPending();
+
+	// Takes the unit when it is of a type this pool spawns, otherwise leaves it be.
+	// A taken unit is destroyed on the spot; only its storage stays behind.
+	void Park(std::unique_ptr<Character>& unit);
+	size_t Spare() const;
+};
@@ -0,0 +1,82 @@
+#pragma once
+#include "code/header/GameManagement/BattleRandom.h"
+class Character;
+class BattlefieldIndex;
+class FighterStats;
+
+// How a brain weighs a candidate target. Every bonus is added on top of the
+// health term, so a weight of 0.0 leaves the score untouched.
+struct ThreatPolicy {
+	enum class Health : std::uint8_t {
+		Ratio,       // target health / target max health
+		Missing,     // 1 - target health / target max health
+		AgainstSelf  // target health / the chooser's max health
+	};
+	Health health = Health::Ratio;
+	double domain = 0.0;      // target curse user has its domain expanded
+	double shrine = 0.0;
+	double limitless = 0.0;
+	double infinity = 0.0;    // replaces limitless while Infinity is up, when check_infinity is set
+	bool check_infinity = false;
+	double gifted = 0.0;      // physically gifted, only when not a curse user
+	double spirit = 0.0;      // cursed spirit, only when neither of the above
+	double jitter = 0.01;     // weight of the slot's -5..5 roll for the round
+	bool skip_dead = false;
+};
+
+// Per-battlefield table of the candidates in slot order: one column of kind
+// and technique bits and one of stat slots, filled once whenever the
+// battlefield's membership changes (which only happens between rounds).
+// Brains score from these columns and the health columns of FighterStats, so
+// a pick never touches the candidates themselves. The domain and Infinity
+// bits change mid round; the owners report them through TraitsChanged.
+//
+// The jitter column is one -5..5 roll per slot, drawn from the board's own
+// stream on the first pick of each round and shared by every brain; policies
+// only weigh it differently.
+//
+// A policy's first pick of a round scores every slot once and keeps the best
+// rows as its shortlist; later picks rescore only the shortlist against live
+// health and traits, so a round costs one pass per policy rather than one per
+// turn. A fighter that climbs past the shortlist mid round is seen from the
+// next round on. When no listed row is usable any more the pick falls back to
+// a full pass.
+class ThreatBoard {
+	static constexpr size_t shortlist_size = 8;
+	static constexpr size_t max_shortlists = 16; // reserved up front so rounds never allocate
+
+	struct Shortlist {
+		const ThreatPolicy* policy = nullptr;
+		double self_max = 0.0; // chooser max health for AgainstSelf policies, 0 otherwise
+		unsigned round = 0;
+		size_t count = 0;
+		std::array<std::uint32_t, shortlist_size> rows{};
+	};
+
+	std::vector<Character*> fighters;
+	std::vector<std::uint16_t> traits;
+	std::vector<std::uint32_t> stat_slots;
+	std::vector<int> rolls;
+	std::vector<Shortlist> shortlists;
+	const FighterStats* stats = nullptr;
+	BattleRandom rng;
+	unsigned generation = 0;
+	unsigned round = 1;
+	unsigned rolled_round = 0;
+	bool built = false;
+
+	bool Eligible(size_t row, const ThreatPolicy&) const;
+	double Score(size_t row, const ThreatPolicy&, double self_max) const;
+	void Build(Shortlist&);
+	Shortlist* ShortlistFor(const ThreatPolicy&, double self_max);
+public:
+	void Reseed(BattleRandom stream);
+	// Rolls drawn before this are stale.
+	void BeginRound();
+	void Refresh(const BattlefieldIndex&, const FighterStats&);
+	// slot is the fighter's battlefield slot; stale or foreign rows are ignored.
+	void TraitsChanged(int slot, const Character&);
+	size_t Size() const;
+	// policy must outlive the battle: its address keys the shortlist.
+	Character* Pick(const Character* self, const ThreatPolicy& policy);
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+// Bump memory for temporaries that never outlive the turn they are made in:
+// upkeep bookkeeping, names formatted for a taunt, and so on. BattleContext
+// resets it at every turn boundary, so nothing allocated here may be kept
+// past the current turn. When a turn needs more than the buffer holds the
+// excess comes from the heap, and the next Reset grows the buffer to the
+// high water mark, so a battle settles at no heap traffic per turn.
+class TurnScratch : public std::pmr::memory_resource {
+	std::unique_ptr<std::byte[]> buffer;
+	size_t capacity = 0;
+	size_t used = 0;
+	size_t overflow_bytes = 0;
+	struct Spill {
+		void* block;
+		size_t bytes;
+		size_t alignment;
+	};
+	std::vector<Spill> overflow;
+	size_t overflows = 0;
+
+	void ReleaseOverflow();
+
+	void* do_allocate(size_t bytes, size_t alignment) override;
+	void do_deallocate(void*, size_t, size_t) override;
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+public:
+	explicit TurnScratch(size_t initial_capacity = 16 * 1024);
+	~TurnScratch() override;
+	TurnScratch(const TurnScratch&) = delete;
+	TurnScratch& operator=(const TurnScratch&) = delete;
+
+	void Reset();
+	size_t Capacity() const;
+	size_t Overflows() const;
+};
+
+using ScratchString = std::pmr::string;
+template<typename T>
+using ScratchVector = std::pmr::vector<T>;
@@ -17,7 +17,6 @@ namespace Utilities {
     }
     int GetValidInput();
     double GetPreciseInput();
-    int GetRandomNumber(int min, int max);
     void WaitForInput();
     std::string StringPad(const std::string& string, size_t length);
 }
@@ -1,7 +1,8 @@
 #pragma once
+#include "code/header/GameManagement/BattleArena.h"
 class CurseUser;
 
-class Specials {
+class Specials : public ArenaAllocated {
 protected:
 	std::string special_name = "";
 	std::string special_color = "";
@@ -3,6 +3,7 @@
 
 class UnlimitedPurple : public Specials {
 public:
+	static constexpr std::string_view roster_name = "Unlimited Purple";
 	UnlimitedPurple();
 	std::unique_ptr<Specials> Clone() const override;
 	void PerformSpecial(CurseUser* user) override;
@@ -3,6 +3,7 @@
 
 class WorldCuttingSlash : public Specials {
 public:
+	static constexpr std::string_view roster_name = "World Cutting Slash";
 	WorldCuttingSlash();
 	std::unique_ptr<Specials> Clone() const override;
 	void PerformSpecial(CurseUser* user) override;
@@ -5,12 +5,13 @@ class CurseUser;
 class Character;
 struct Battlefield;
 
-class Copy : public Technique {
+class Copy final : public Technique {
 private:
 	std::vector<std::unique_ptr<Technique>> copied_techniques;
 	static constexpr int max_copies = 5;
 	size_t active_copy = 0;
 public:
+	static constexpr std::string_view roster_name = "Copy";
 	Copy();
 	std::unique_ptr<Technique> Clone() const override;
 
@@ -22,6 +23,6 @@ public:
 	void TechniqueMenu(CurseUser* user, Character* target, Battlefield&) override;
 	bool AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf) override;
 	void TechniqueSetting(CurseUser* user, Battlefield&) override;
-	void Chant() override;
+	void Chant(CurseUser* user) override;
 	bool IsCopy() const override;
 };
\ No newline at end of file
@@ -5,22 +5,24 @@ class CurseUser;
 class Character;
 struct Battlefield;
 
-class IdleTransfiguration : public Technique {
+class IdleTransfiguration final : public Technique {
 protected:
 	int transfigured_human_count = 3;
-	const double transfiguration_damage = 100.0;
+	double transfiguration_damage = 100.0;
 public:
+	static constexpr std::string_view roster_name = "Idle Transfiguration";
 	IdleTransfiguration();
 
 	void UseTransfiguration(CurseUser* user, Character* target);
-	void SummonTransfiguredHumans(Battlefield&);
+	int SummonTransfiguredHumans(Battlefield&, int count);
 	void GetTransfiguredSummonAmount(Battlefield&);
 
 	int GetTFcount() const;
 
-	void Chant() override;
+	void Chant(CurseUser* user) override;
 	void TechniqueMenu(CurseUser* user, Character* target, Battlefield&) override;
 	bool AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf) override;
 	void TechniqueSetting(CurseUser*, Battlefield&) override;
 	std::unique_ptr<Technique> Clone() const override;
+	bool Tune(std::string_view key, double value) override;
 };
\ No newline at end of file
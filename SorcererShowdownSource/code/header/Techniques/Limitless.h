@@ -5,23 +5,24 @@ class CurseUser;
 class Character;
 struct Battlefield;
 
-class Limitless : public Technique { 
+class Limitless final : public Technique { 
 protected:
 	bool Infinity = true;
 	bool unlimited_hollow_purple_allowed = false;
 	int blue_used_amount = 0;
 	int red_used_amount = 0;
 	int purple_used_amount = 0;
-	static constexpr double blue_output = 105.0;
-	static constexpr double red_output = 145.0;
-	static constexpr double purple_output = 250.0;
-	static constexpr double unlpurple_output = 2000.0;
+	double blue_output = 105.0;
+	double red_output = 145.0;
+	double purple_output = 250.0;
+	double unlpurple_output = 2000.0;
 	bool up_used = false;
 public:
+	static constexpr std::string_view roster_name = "Limitless";
 	Limitless();
 	std::unique_ptr<Technique> Clone() const override;
 
-	void SetInfinity(bool s);
+	void SetInfinity(CurseUser* user, bool s);
 	void InfinityNerf(CurseUser*);
 	bool CheckInfinity() const;
 
@@ -41,8 +42,9 @@ public:
 	void TechniqueMenu(CurseUser* user, Character* target, Battlefield&) override;
 	bool AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf) override;
 	void TechniqueSetting(CurseUser*, Battlefield&) override;
-	void Chant() override;
+	void Chant(CurseUser* user) override;
 
+	bool Tune(std::string_view key, double value) override;
 	bool IsLimitless() const override;
 	bool IsInfinityActive() const override;
 };
@@ -5,20 +5,21 @@ class CurseUser;
 class Character;
 struct Battlefield;
 
-class PrivatePureLoveTrain : public Technique {
+class PrivatePureLoveTrain final : public Technique {
 protected:
-	const double GOLDEN_SHUTTER_DAMAGE = 90.0;
-	const double RED_SHUTTER_DAMAGE = 25.0;
-	const double GREEN_SHUTTER_DAMAGE = 55.0;	
+	double GOLDEN_SHUTTER_DAMAGE = 90.0;
+	double RED_SHUTTER_DAMAGE = 25.0;
+	double GREEN_SHUTTER_DAMAGE = 55.0;	
 
-	const double GOLDEN_PLINKO_DAMAGE = 65.0;
-	const double RED_PLINKO_DAMAGE = 10.0;
-	const double GREEN_PLINKO_DAMAGE = 35.0;
+	double GOLDEN_PLINKO_DAMAGE = 65.0;
+	double RED_PLINKO_DAMAGE = 10.0;
+	double GREEN_PLINKO_DAMAGE = 35.0;
 
 	int plinko_cooldown_time = 0;
 	const int max_plinko_cooldown_time = 2;
 	bool plinko_used = false;
 public:
+	static constexpr std::string_view roster_name = "Private Pure Love Train";
 	PrivatePureLoveTrain();
 
 	bool PlinkoUsed() const;
@@ -32,4 +33,5 @@ public:
 	void TechniqueMenu(CurseUser* user, Character* target, Battlefield&) override;
 	bool AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf) override;
 	std::unique_ptr<Technique> Clone() const override;
+	bool Tune(std::string_view key, double value) override;
 };
\ No newline at end of file
@@ -5,13 +5,14 @@ class CurseUser;
 class Character;
 struct Battlefield;
 
-class Shrine : public Technique { 
+class Shrine final : public Technique { 
 protected:
-	static constexpr double slash_output = 65.0;
-	static constexpr double cleave_output = 300.0;
-	static constexpr double wcs_output = 2500.0;
+	double slash_output = 65.0;
+	double cleave_output = 300.0;
+	double wcs_output = 2500.0;
 	bool world_cutting_slash_allowed = false;
 public:
+	static constexpr std::string_view roster_name = "Shrine";
 	Shrine();
 	std::unique_ptr<Technique> Clone() const override;
 
@@ -25,7 +26,8 @@ public:
 	void TechniqueMenu(CurseUser* user, Character* target, Battlefield&) override;
 	bool AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf) override;
 	void TechniqueSetting(CurseUser*, Battlefield&) override;
-	void Chant() override;
+	void Chant(CurseUser* user) override;
 	
+	bool Tune(std::string_view key, double value) override;
 	bool IsShrine() const override;
 };
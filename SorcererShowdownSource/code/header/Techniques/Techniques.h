@@ -1,12 +1,19 @@
 #pragma once
+#include "code/header/GameManagement/BattleArena.h"
 class CurseUser;
 class Character;
 struct Battlefield;
 
-class Technique { 
+class Technique : public ArenaAllocated { 
+public:
+	// Every technique in the game, each a final class. Anything else stays
+	// Other and is reached through the vtable.
+	enum class Kind : std::uint8_t { Other, Copy, IdleTransfiguration, Limitless, PrivatePureLoveTrain, Shrine };
 protected:
-	std::string name;
-	std::string color;
+	Kind kind = Kind::Other;
+	// always string literals, so copying a technique mid battle copies no strings
+	std::string_view name;
+	std::string_view color;
 public:
 	virtual ~Technique();
 	
@@ -17,6 +24,7 @@ public:
 
 	std::string GetTechniqueName() const;
 	std::string GetTechniqueSimpleName() const;
+	bool SameTechniqueAs(const Technique&) const;
 	
 	virtual void Set(Status s);
 	Status GetStatus() const;
@@ -25,12 +33,24 @@ public:
 	double CalculateDamage(CurseUser* user, double cost) const;
 	std::string GetStringStatus() const;
 
-	virtual void Chant();
+	virtual void Chant(CurseUser* user);
 	virtual void TechniqueSetting(CurseUser*, Battlefield&);
 	virtual void TechniqueMenu(CurseUser* user, Character* target, Battlefield&) = 0;
 	virtual bool AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf) = 0;
 	virtual std::unique_ptr<Technique> Clone() const = 0;
 
+	Kind GetKind() const;
+	// The name rosters and tuning tables know this technique by.
+	std::string_view RosterName() const;
+	// Sets one of the technique's tuning constants, false for a key it does not have.
+	virtual bool Tune(std::string_view key, double value);
+	// AutoTechniqueUse through a switch on kind, which calls the final
+	// class directly so the compiler can devirtualize and inline it.
+	bool DispatchAutoUse(CurseUser* user, Character* target, Battlefield& bf);
+	// Whether kind names this object's dynamic class, which the dispatch
+	// casts rely on; asserted in debug builds.
+	bool KindMatchesType() const;
+
 	std::string GetStringChantLevel() const;
 	double GetChantPower() const;
 
@@ -4,6 +4,11 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <memory_resource>
+#include <bit>
+#include <typeindex>
+#include <cstddef>
+#include <cassert>
 #include <algorithm>
 #include <ranges>
 #include <format>
@@ -15,4 +20,13 @@
 #include <filesystem>
 #include <map>
 #include <sstream>
-#include <stdexcept>
\ No newline at end of file
+#include <stdexcept>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <array>
+#include <span>
+#include <string_view>
+#include <mutex>
+#include <functional>
\ No newline at end of file
@@ -11,38 +11,12 @@
 #include "code/header/Domains/Domain.h"
 #include "code/header/Specials/Specials.h"
 
-Character* Aggressive::GetTarget(Character* user, Battlefield& bf){
-    Character* target = nullptr;
-    double best_score = -1.0;
-
-    for (const auto& ch : bf.battlefield) {
-        if (ch.get() == user) continue;
-
-        double score = ch->GetCharacterHealth() / ch->GetCharacterMaxHealth();
-
-        if (ch->IsaCurseUser()) {
-            auto cu = static_cast<CurseUser*>(ch.get());
-
-            if (cu->DomainActive()) score += 1.0;
-
-            if (auto* tech = cu->GetTechnique()) {
-                if (tech->IsShrine()) score += 0.55;
-                if (tech->IsLimitless()) score += 0.60;
-            }
-        }
-        else if (ch->IsPhysicallyGifted()) {
-            score += 0.5;
-        }
-
-        score += Utilities::GetRandomNumber(-5, 5) * 0.025;
-
-        if (score > best_score) {
-            best_score = score;
-            target = ch.get();
-        }
-    }
+namespace {
+    const ThreatPolicy aggressive_policy = { .domain = 1.0, .shrine = 0.55, .limitless = 0.60, .gifted = 0.5, .jitter = 0.025 };
+}
 
-    return target;
+Character* Aggressive::GetTarget(Character* user, Battlefield& bf){
+    return bf.context.Threats().Pick(user, aggressive_policy);
 }
 
 void Aggressive::UseRCT(Sorcerer* user) {
@@ -74,22 +48,16 @@ void Aggressive::UseReinforcement(CurseUser* user) {
 }
 
 bool Aggressive::TryDomainActions(CurseUser* user, Battlefield& bf, Character*) {
-    std::vector<CurseUser*> domain_users;
-    for (const auto& ch : bf.battlefield) {
-        if (ch.get() == user) continue; 
-        if (!ch->IsaCurseUser()) continue; 
-        auto* crs = static_cast<CurseUser*>(ch.get()); 
-        if (crs->GetDomain() && crs->DomainActive()) domain_users.push_back(crs); 
-    }
+    const int other_domains = bf.context.Index().OtherActiveDomains(user);
 
-    if (!domain_users.empty()) {
+    if (other_domains > 0) {
         if (user->GetDomain() && !user->DomainActive() && !user->IsStrained() && user->GetDomainUses() < 5) {
             if ((!user->GetTechnique() || !user->GetTechnique()->BurntOut())) {
-                if (domain_users.size() == 1) {
+                if (other_domains == 1) {
                     user->ActivateDomain();
                     return true;
                 }
-                else if (domain_users.size() > 1 && Utilities::GetRandomNumber(1, 100) >= 95) {
+                else if (other_domains > 1 && user->GetRandom().Next(1, 100) >= 95) {
                     user->ActivateDomain();
                     return true;
                 }
@@ -101,11 +69,11 @@ bool Aggressive::TryDomainActions(CurseUser* user, Battlefield& bf, Character*)
         }
     }
     else {
-        if (user->CounterDomainActive() && Utilities::GetRandomNumber(1, 10) >= 6) {
+        if (user->CounterDomainActive() && user->GetRandom().Next(1, 10) >= 6) {
             user->DeactivateCounterDomain(); 
             return true; 
         }
-        if (Utilities::GetRandomNumber(1, 100) <= 25 && user->GetDomain() && !user->DomainActive() && !user->IsStrained() && user->GetDomainUses() < 5 && (!user->GetTechnique() || !user->GetTechnique()->BurntOut())) {
+        if (user->GetRandom().Next(1, 100) <= 25 && user->GetDomain() && !user->DomainActive() && !user->IsStrained() && user->GetDomainUses() < 5 && (!user->GetTechnique() || !user->GetTechnique()->BurntOut())) {
             user->ActivateDomain(); 
             return true; 
         }
@@ -114,13 +82,7 @@ bool Aggressive::TryDomainActions(CurseUser* user, Battlefield& bf, Character*)
 }
 
 bool Aggressive::TryTechniqueActions(CurseUser* user, Battlefield& bf, Character* target) {
-    bool target_infinity = false; 
-    if (target->IsaCurseUser()) {
-        auto tr = static_cast<CurseUser*>(target); 
-        if (auto* tech = tr->GetTechnique()) {
-            if (tech->IsLimitless() && tech->IsInfinityActive()) target_infinity = true; 
-        }
-    }
+    bool target_infinity = target->InfinityActive();
     if (target_infinity) {
         user->SetAmplification(true);
     }
@@ -130,12 +92,12 @@ bool Aggressive::TryTechniqueActions(CurseUser* user, Battlefield& bf, Character
 
     if (user->GetTechnique() && !user->GetTechnique()->BurntOut() && !user->DomainAmplificationActive()) {
         if (user->CEMoreThanMax(0.20)) {
-            if (user->GetTechnique()->AutoTechniqueUse(user, target, bf)) {
+            if (user->GetTechnique()->DispatchAutoUse(user, target, bf)) {
                 return true;
             }
         }
     }
-    if (user->GetSpecial() && Utilities::GetRandomNumber(1, 100) <= 20) {
+    if (user->GetSpecial() && user->GetRandom().Next(1, 100) <= 20) {
         user->GetSpecial()->PerformSpecial(user);
     }
     return false;
@@ -160,13 +122,7 @@ bool Aggressive::TryInventoryActions(Character* user, Character* target) {
         return false; 
     }
 
-    bool target_infinity = false; 
-    if (target->IsaCurseUser()) {
-        auto tr = static_cast<CurseUser*>(target); 
-        if (auto* tech = tr->GetTechnique()) {
-            if (tech->IsLimitless() && tech->IsInfinityActive()) target_infinity = true; 
-        }
-    }
+    bool target_infinity = target->InfinityActive();
 
     if (target_infinity) {
         if (tool && tool->IsAntiTechniqueWeapon()) return false; 
@@ -178,14 +134,14 @@ bool Aggressive::TryInventoryActions(Character* user, Character* target) {
         }
     }
     else if (!inv.empty() && !tool) {
-        if (Utilities::GetRandomNumber(1, 100) <= 50) {
-            user->CursedToolChoice(static_cast<size_t>(Utilities::GetRandomNumber(1, static_cast<int>(inv.size())))); 
+        if (user->GetRandom().Next(1, 100) <= 50) {
+            user->CursedToolChoice(static_cast<size_t>(user->GetRandom().Next(1, static_cast<int>(inv.size())))); 
             return true; 
         }
     }
     else if (tool && !inv.empty()) {
-        if (Utilities::GetRandomNumber(1, 100) <= 25) {
-            user->CursedToolChoice(static_cast<size_t>(Utilities::GetRandomNumber(1, static_cast<int>(inv.size())))); 
+        if (user->GetRandom().Next(1, 100) <= 25) {
+            user->CursedToolChoice(static_cast<size_t>(user->GetRandom().Next(1, static_cast<int>(inv.size())))); 
             return true; 
         }
     }
@@ -11,38 +11,12 @@
 #include "code/header/Domains/Domain.h"
 #include "code/header/Specials/Specials.h"
 
-Character* Reactive::GetTarget(Character* user, Battlefield& bf){
-    Character* target = nullptr;
-    double best_score = -1.0;
-
-    for (const auto& ch : bf.battlefield) {
-        if (ch.get() == user) continue;
-
-        double score = 1.0 - (ch->GetCharacterHealth() / ch->GetCharacterMaxHealth());
-
-        if (ch->IsaCurseUser()) {
-            auto cu = static_cast<CurseUser*>(ch.get());
-
-            if (cu->DomainActive()) score -= 0.5;
-
-            if (auto* tech = cu->GetTechnique()) {
-                if (tech->IsShrine()) score -= 0.5;
-                if (tech->IsLimitless()) score -= 0.2;
-            }
-        }
-        else if (ch->IsPhysicallyGifted()) {
-            score += 0.8;
-        }
-
-        score += Utilities::GetRandomNumber(-5, 5) * 0.025;
-
-        if (score > best_score) {
-            best_score = score;
-            target = ch.get();
-        }
-    }
+namespace {
+    const ThreatPolicy reactive_policy = { .health = ThreatPolicy::Health::Missing, .domain = -0.5, .shrine = -0.5, .limitless = -0.2, .gifted = 0.8, .jitter = 0.025 };
+}
 
-    return target;
+Character* Reactive::GetTarget(Character* user, Battlefield& bf){
+    return bf.context.Threats().Pick(user, reactive_policy);
 }
 
 void Reactive::UseRCT(Sorcerer* user) {
@@ -84,15 +58,9 @@ void Reactive::UseShikigami(CurseUser* user) {
 }
 
 bool Reactive::TryDomainActions(CurseUser* user, Battlefield& bf, Character*) {
-    std::vector<CurseUser*> domain_users; 
-    for (const auto& ch : bf.battlefield) {
-        if (ch.get() == user) continue; 
-        if (!ch->IsaCurseUser()) continue; 
-        auto* crs = static_cast<CurseUser*>(ch.get()); 
-        if (crs->GetDomain() && crs->DomainActive()) domain_users.push_back(crs); 
-    }
+    const int other_domains = bf.context.Index().OtherActiveDomains(user);
 
-    if (!domain_users.empty()) {
+    if (other_domains > 0) {
         if (user->GetDomain() && !user->DomainActive() && user->GetDomainUses() < 5 && !user->IsStrained()) {
             if (!user->GetTechnique() || !user->GetTechnique()->BurntOut())
             user->ActivateDomain();
@@ -104,11 +72,11 @@ bool Reactive::TryDomainActions(CurseUser* user, Battlefield& bf, Character*) {
         }
     }
     else {
-        if (user->CounterDomainActive() && Utilities::GetRandomNumber(1, 10) >= 6) {
+        if (user->CounterDomainActive() && user->GetRandom().Next(1, 10) >= 6) {
             user->DeactivateCounterDomain(); 
             return true;
         }
-        if (user->GetDomain() && !user->DomainActive() && !user->IsStrained() && user->GetDomainUses() < 5 && Utilities::GetRandomNumber(1, 100) >= 60) {
+        if (user->GetDomain() && !user->DomainActive() && !user->IsStrained() && user->GetDomainUses() < 5 && user->GetRandom().Next(1, 100) >= 60) {
             if (!user->GetTechnique() || !user->GetTechnique()->BurntOut()) {
                 user->ActivateDomain();
                 return true;
@@ -119,13 +87,7 @@ bool Reactive::TryDomainActions(CurseUser* user, Battlefield& bf, Character*) {
 }
 
 bool Reactive::TryTechniqueActions(CurseUser* user, Battlefield& bf, Character* target) {
-    bool target_infinity = false; 
-    if (target->IsaCurseUser()) {
-        auto tr = static_cast<CurseUser*>(target); 
-            if (auto* tech = tr->GetTechnique()) {
-                if (tech->IsLimitless() && tech->IsInfinityActive()) target_infinity = true; 
-            }
-    }
+    bool target_infinity = target->InfinityActive();
 
     if (target_infinity) {
         user->SetAmplification(true);
@@ -136,12 +98,12 @@ bool Reactive::TryTechniqueActions(CurseUser* user, Battlefield& bf, Character*
 
     if (user->GetTechnique() && !user->GetTechnique()->BurntOut() && !user->DomainAmplificationActive()) {
         if (!user->HPMoreThanMax(0.50) || user->GetTechnique()->Boosted()) {
-            if (user->GetTechnique()->AutoTechniqueUse(user, target, bf)) {
+            if (user->GetTechnique()->DispatchAutoUse(user, target, bf)) {
                 return true;
             }
         }
     }
-    if (user->GetSpecial() && Utilities::GetRandomNumber(1, 100) <= 20) {
+    if (user->GetSpecial() && user->GetRandom().Next(1, 100) <= 20) {
         user->GetSpecial()->PerformSpecial(user);
     }
     return false; 
@@ -155,13 +117,7 @@ bool Reactive::TryInventoryActions(Character* user, Character* target) {
         return false; 
     }
 
-    bool target_infinity = false; 
-    if (target->IsaCurseUser()) {
-        auto tr = static_cast<CurseUser*>(target); 
-        if (auto* tech = tr->GetTechnique()) {
-            if (tech->IsLimitless() && tech->IsInfinityActive()) target_infinity = true; 
-        }
-    }
+    bool target_infinity = target->InfinityActive();
 
     if (target_infinity) {
         if (tool && tool->IsAntiTechniqueWeapon()) return false; 
@@ -174,14 +130,14 @@ bool Reactive::TryInventoryActions(Character* user, Character* target) {
         }
     }
     else if (!inv.empty() && !tool) {
-        if (Utilities::GetRandomNumber(1, 100) <= 50) {
-            user->CursedToolChoice(static_cast<size_t>(Utilities::GetRandomNumber(1, static_cast<int>(inv.size())))); 
+        if (user->GetRandom().Next(1, 100) <= 50) {
+            user->CursedToolChoice(static_cast<size_t>(user->GetRandom().Next(1, static_cast<int>(inv.size())))); 
             return true; 
         }
     }
     else if (tool && !inv.empty()) {
-        if (Utilities::GetRandomNumber(1, 100) <= 25) {
-            user->CursedToolChoice(static_cast<size_t>(Utilities::GetRandomNumber(1, static_cast<int>(inv.size())))); 
+        if (user->GetRandom().Next(1, 100) <= 25) {
+            user->CursedToolChoice(static_cast<size_t>(user->GetRandom().Next(1, static_cast<int>(inv.size())))); 
             return true; 
         }
     }
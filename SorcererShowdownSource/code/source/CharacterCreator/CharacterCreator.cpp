@@ -1,4 +1,9 @@
 #include "code/header/CharacterCreator/CharacterCreator.h"
+#include "code/header/CharacterCreator/RosterRegistry.h"
+#include "code/header/CharacterCreator/RosterReader.h"
+#include "code/header/CharacterCreator/RosterCache.h"
+#include "code/header/CharacterCreator/TuningTable.h"
+#include "code/header/GameManagement/MappedFile.h"
 #include "code/header/CharacterCreator/AI/CharacterAI.h"
 #include "code/header/CharacterCreator/AI/Aggressive.h"
 #include "code/header/CharacterCreator/AI/Reactive.h"
@@ -47,6 +52,10 @@ static std::unique_ptr<CharacterBrain> GetBrainType(const std::string& name);
 static std::unique_ptr<Specials> GetSpecialByName(const std::string& name);
 static std::unique_ptr<CursedTool> GetToolByName(const std::string& name);
 static std::unique_ptr<Shikigami> GetShikigamiByName(const std::string& name);
+static bool ReadTuning(const json& j, TuningTable& table, std::string_view where);
+
+CharacterCreator::CharacterCreator(const TuningTable* t) : tuning(t) {
+}
 
 std::unique_ptr<Character> CharacterCreator::CreateJsonObject(const json& j) {
     std::string type = j.at("type").get<std::string>();
@@ -81,7 +90,7 @@ std::unique_ptr<Character> CharacterCreator::CreateJsonObject(const json& j) {
     if (!character) return nullptr;
 
     if (j.contains("ai_type")) {
-        character->SetBrain(GetBrainType(j.at("ai_type").get<std::string>()));
+        character->SetBrain(GetBrainType(j.at("ai_type").get_ref<const std::string&>()));
     }
 
     if (j.contains("base_attack_damage")) {
@@ -94,10 +103,10 @@ std::unique_ptr<Character> CharacterCreator::CreateJsonObject(const json& j) {
             curse_ptr->SetBlackflashChance(j.at("blackflash_chance").get<int>());
         }
         if (j.contains("technique")) {
-            curse_ptr->SetTechnique(GetTechniqueByName(j.at("technique").get<std::string>()));
+            curse_ptr->SetTechnique(GetTechniqueByName(j.at("technique").get_ref<const std::string&>()));
         }
         if (j.contains("domain")) {
-            curse_ptr->SetDomain(GetDomainByName(j.at("domain").get<std::string>()));
+            curse_ptr->SetDomain(GetDomainByName(j.at("domain").get_ref<const std::string&>()));
         }
         if (j.contains("domain_limit")) {
             curse_ptr->SetDomainLimit(j.at("domain_limit").get<int>());
@@ -118,108 +127,246 @@ std::unique_ptr<Character> CharacterCreator::CreateJsonObject(const json& j) {
             curse_ptr->SetMaxBurnoutTime(j.at("max_burnout_time").get<int>());
         }
         if (j.contains("counter_domain")) {
-            curse_ptr->SetCounterDomain(GetCounterDomainByName(j.at("counter_domain").get<std::string>()));
+            curse_ptr->SetCounterDomain(GetCounterDomainByName(j.at("counter_domain").get_ref<const std::string&>()));
         }
         if (j.contains("special")) {
-            curse_ptr->SetSpecial(GetSpecialByName(j.at("special").get<std::string>()));
+            curse_ptr->SetSpecial(GetSpecialByName(j.at("special").get_ref<const std::string&>()));
         }
         if (j.contains("shikigami") && j.at("shikigami").is_array()) {
             for (const auto& name : j.at("shikigami")) {
-                curse_ptr->AddShikigami(GetShikigamiByName(name.get<std::string>()));
+                if (auto shiki = GetShikigamiByName(name.get_ref<const std::string&>())) curse_ptr->AddShikigami(std::move(shiki));
             }
         }
     }
     if (j.contains("equipped_tool")) {
-        character->SetEquippedTool(GetToolByName(j.at("equipped_tool").get<std::string>()));
+        character->SetEquippedTool(GetToolByName(j.at("equipped_tool").get_ref<const std::string&>()));
     }
     if (j.contains("inventory") && j.at("inventory").is_array()) {
         for (const auto& item : j.at("inventory")) {
-            character->AddToolToInventory(GetToolByName(item.get<std::string>()));
+            character->AddToolToInventory(GetToolByName(item.get_ref<const std::string&>()));
         }
     }
     character->SetCharacterName(j.at("name").get<std::string>(), j.value("color", ""));
-    character->AssignID();
+
+    if (tuning) tuning->Apply(*character);
+    if (j.contains("tuning")) {
+        TuningTable overrides;
+        ReadTuning(j.at("tuning"), overrides, std::format("\"{}\"", character->GetSimpleName()));
+        overrides.Apply(*character);
+    }
     return character;
 }
 
-void CharacterCreator::LoadJsonObject(BattleCreator& bc) {
-    std::cout << "Looking for JSON in: " << std::filesystem::current_path() << '\n';
-    std::ifstream file("characters.json");
+// One roster file's index, scanned off the main thread and added to the
+// roster afterwards so the order never depends on which file finished first.
+struct ScannedRoster {
+    struct Entry {
+        std::string name;
+        size_t offset = 0;
+        size_t size = 0;
+        RosterPosition at;
+    };
+    std::string path;
+    std::unique_ptr<MappedFile> file;
+    std::vector<Entry> entries;
+    std::string error;
+};
 
-    if (!file.is_open()) {
-        std::cerr << "Could not find characters.json!" << '\n';
-        Utilities::WaitForInput();
-        return;
+static ScannedRoster ScanRoster(std::string path, bool use_cache) {
+    ScannedRoster scanned{ .path = std::move(path), .file = nullptr, .entries = {}, .error = "" };
+    scanned.file = std::make_unique<MappedFile>(scanned.path);
+    if (!scanned.file->IsOpen()) {
+        scanned.file.reset();
+        return scanned;
     }
-    nlohmann::json data;
-    try {
-        file >> data;
+
+    const std::string_view text = scanned.file->View();
+    auto on_entry = [&](const RosterSpan& span, const RosterPosition& at) {
+        scanned.entries.push_back({ .name = std::string(span.name), .offset = span.offset, .size = span.size, .at = at });
+    };
+    // A cache built from these exact bytes skips the scan entirely.
+    const std::filesystem::path cache_path = RosterCache::PathFor(scanned.path);
+    if (use_cache && RosterCache::Read(cache_path, text, on_entry)) return scanned;
+
+    RosterCache::Builder cache;
+    auto read_entry = [&](const RosterSpan& span, const RosterPosition& at) {
+        if (use_cache) cache.Add(span, at);
+        on_entry(span, at);
+    };
+    if (!RosterReader::Read(text, read_entry, scanned.error)) return scanned;
+    if (use_cache) cache.Save(cache_path, text);
+    return scanned;
+}
+
+// Reports what went wrong in the file and adds the rest. An entry without
+// a name can never be asked for, so it is skipped here. False on any error.
+static bool AddScanned(BattleCreator& bc, ScannedRoster& scanned) {
+    if (!scanned.file) {
+        std::cerr << "Could not find " << scanned.path << "!" << '\n';
+        return false;
     }
-    catch (const nlohmann::json::parse_error& e) {
-        std::cerr << "JSON Parse Error: " << e.what() << '\n';
-        Utilities::WaitForInput();
-        return;
+    bool clean = scanned.error.empty();
+    const size_t source = bc.characterlist.AddSource(scanned.path, std::move(scanned.file));
+    for (const ScannedRoster::Entry& entry : scanned.entries) {
+        if (entry.name.empty()) {
+            std::cerr << scanned.path << ":" << entry.at.line << ":" << entry.at.column << ": skipped character " << entry.at.index << ": expected an object with a \"name\" string" << '\n';
+            clean = false;
+            continue;
+        }
+        bc.characterlist.AddEntry(source, { .offset = entry.offset, .size = entry.size, .name = entry.name }, entry.at);
+    }
+    if (!scanned.error.empty()) std::cerr << "JSON Parse Error in " << scanned.path << ": " << scanned.error << '\n';
+    return clean;
+}
+
+// Every .json file directly inside dir, in name order.
+static std::vector<std::string> RosterFiles(const std::filesystem::path& dir) {
+    std::vector<std::filesystem::path> found;
+    std::error_code ec;
+    for (const auto& item : std::filesystem::directory_iterator(dir, ec)) {
+        if (item.is_regular_file(ec) && item.path().extension() == ".json") found.push_back(item.path());
     }
+    std::ranges::sort(found);
+    std::vector<std::string> files;
+    for (const auto& path : found) files.push_back(path.string());
+    return files;
+}
+
+void CharacterCreator::LoadJsonObject(BattleCreator& bc) {
+    if (bc.interactive) std::cout << "Looking for JSON in: " << std::filesystem::current_path() << '\n';
 
-    if (data.contains("characters") && data["characters"].is_array()) {
-        for (const auto& charData : data["characters"]) {
-            std::unique_ptr<Character> newChar = CharacterCreator::CreateJsonObject(charData);
-            if (newChar) {
-                bc.characterlist.push_back(std::move(newChar));
+    // Only names and spans are read here; RosterIndex builds a character when
+    // it is first used. A directory holds one roster (or one character) per
+    // file. Its files are scanned on all cores and added in name order, and
+    // are not cached individually.
+    bool clean = true;
+    if (std::filesystem::is_directory(bc.roster_path)) {
+        const std::vector<std::string> files = RosterFiles(bc.roster_path);
+        std::vector<ScannedRoster> scanned(files.size());
+        std::atomic<size_t> next_file = 0;
+        const size_t threads = std::min<size_t>(files.size(), std::max(1u, std::thread::hardware_concurrency()));
+        {
+            std::vector<std::jthread> workers;
+            for (size_t t = 0; t < threads; t++) {
+                workers.emplace_back([&] {
+                    while (true) {
+                        size_t i = next_file.fetch_add(1, std::memory_order_relaxed);
+                        if (i >= files.size()) return;
+                        scanned[i] = ScanRoster(files[i], false);
+                    }
+                });
             }
         }
+        for (ScannedRoster& roster : scanned) clean &= AddScanned(bc, roster);
+    }
+    else {
+        ScannedRoster roster = ScanRoster(bc.roster_path, true);
+        clean = AddScanned(bc, roster);
+    }
+
+    if (bc.interactive) {
+        // the menu lists every character, so build them all now
+        clean &= bc.characterlist.BuildAll();
+        if (!clean) Utilities::WaitForInput();
         UserInterface::ClearScreen();
     }
 }
 
+// Everything a roster file can name, by field. Each type carries its own
+// roster_name; adding a type to one of these lists is all the loader needs.
+using TechniqueRegistry = RosterRegistry<Technique, Limitless, Shrine, PrivatePureLoveTrain, IdleTransfiguration, Copy>;
+using BrainRegistry = RosterRegistry<CharacterBrain, Aggressive, Reactive, Randomized, Brawler>;
+using DomainRegistry = RosterRegistry<Domain, InfiniteVoid, MalevolentShrine, AuthenticMutualLove, IdleDeathGamble, SelfEmbodimentOfPerfection>;
+using CounterDomainRegistry = RosterRegistry<Domain, SimpleDomain, HollowWickerBasket>;
+using SpecialRegistry = RosterRegistry<Specials, UnlimitedPurple, WorldCuttingSlash>;
+using ToolRegistry = RosterRegistry<CursedTool, InvertedSpearofHeaven, PlayfulCloud, SplitSoulKatana, Katana>;
+using ShikigamiRegistry = RosterRegistry<Shikigami, Agito, Mahoraga, Rika>;
+
+template<typename Registry>
+static auto MakeFromRoster(const std::string& name, std::string_view field) {
+    auto made = Registry::Make(name);
+    if (!made) {
+        std::cerr << "Unknown " << field << " \"" << name << "\", expected one of: " << Registry::Names() << '\n';
+    }
+    return made;
+}
+
 static std::unique_ptr<Technique> GetTechniqueByName(const std::string& name) {
-    if (name == "Limitless") return std::make_unique<Limitless>();
-    if (name == "Shrine") return std::make_unique<Shrine>();
-    if (name == "Private Pure Love Train") return std::make_unique<PrivatePureLoveTrain>();
-    if (name == "Idle Transfiguration") return std::make_unique<IdleTransfiguration>();
-    if (name == "Copy") return std::make_unique<Copy>();
-    return nullptr;
+    return MakeFromRoster<TechniqueRegistry>(name, "technique");
 }
 
 static std::unique_ptr<CharacterBrain> GetBrainType(const std::string& name) {
-    if (name == "Aggressive") return std::make_unique<Aggressive>();
-    if (name == "Reactive") return std::make_unique<Reactive>();
-    if (name == "Randomized") return std::make_unique<Randomized>();
-    if (name == "Brawler") return std::make_unique<Brawler>();
+    if (auto brain = MakeFromRoster<BrainRegistry>(name, "ai_type")) return brain;
     return std::make_unique<Aggressive>();
 }
 
 static std::unique_ptr<Domain> GetDomainByName(const std::string& name) {
-    if (name == "Infinite Void") return std::make_unique<InfiniteVoid>();
-    if (name == "Malevolent Shrine") return std::make_unique<MalevolentShrine>();
-    if (name == "Authentic Mutual Love") return std::make_unique<AuthenticMutualLove>();
-    if (name == "Idle Death Gamble") return std::make_unique<IdleDeathGamble>();
-    if (name == "Self Embodiment of Perfection") return std::make_unique<SelfEmbodimentOfPerfection>();
-    return nullptr;
+    return MakeFromRoster<DomainRegistry>(name, "domain");
 }
 static std::unique_ptr<Domain> GetCounterDomainByName(const std::string& name) {
-    if (name == "Simple Domain") return std::make_unique<SimpleDomain>();
-    if (name == "Hollow Wicker Basket") return std::make_unique<HollowWickerBasket>();
-    return nullptr;
+    return MakeFromRoster<CounterDomainRegistry>(name, "counter_domain");
 }
 
 static std::unique_ptr<Specials> GetSpecialByName(const std::string& name) {
-    if (name == "Unlimited Purple") return std::make_unique<UnlimitedPurple>();
-    if (name == "World Cutting Slash") return std::make_unique<WorldCuttingSlash>();
-    return nullptr;
+    return MakeFromRoster<SpecialRegistry>(name, "special");
 }
 
 static std::unique_ptr<CursedTool> GetToolByName(const std::string& name) {
-    if (name == "The Inverted Spear of Heaven") return std::make_unique<InvertedSpearofHeaven>();
-    if (name == "Playful Cloud") return std::make_unique<PlayfulCloud>();
-    if (name == "Split Soul Katana") return std::make_unique<SplitSoulKatana>();
-    if (name == "Katana") return std::make_unique<Katana>();
-    return nullptr;
+    return MakeFromRoster<ToolRegistry>(name, "tool");
 }
 
 static std::unique_ptr<Shikigami> GetShikigamiByName(const std::string& name) {
-    if (name == "Agito") return std::make_unique<Agito>();
-    if (name == "Mahoraga") return std::make_unique<Mahoraga>();
-    if (name == "Rika") return std::make_unique<Rika>();
-    return nullptr;
-}
\ No newline at end of file
+    return MakeFromRoster<ShikigamiRegistry>(name, "shikigami");
+}
+
+// Reads { "<technique or domain>": { "<constant>": number, ... }, ... } into
+// table. Each name and key is checked against a fresh instance from the
+// registries, so a typo is reported once here rather than silently ignored
+// on every character. False if anything was skipped.
+static bool ReadTuning(const json& j, TuningTable& table, std::string_view where) {
+    if (!j.is_object()) {
+        std::cerr << where << ": tuning must be an object" << '\n';
+        return false;
+    }
+    bool clean = true;
+    for (const auto& [section, values] : j.items()) {
+        std::unique_ptr<Technique> technique = TechniqueRegistry::Make(section);
+        std::unique_ptr<Domain> domain = technique ? nullptr : DomainRegistry::Make(section);
+        if (!technique && !domain) domain = CounterDomainRegistry::Make(section);
+        if (!technique && !domain) {
+            std::cerr << where << ": unknown tuning section \"" << section << "\", expected a technique or domain" << '\n';
+            clean = false;
+            continue;
+        }
+        if (!values.is_object()) {
+            std::cerr << where << ": tuning for \"" << section << "\" must be an object" << '\n';
+            clean = false;
+            continue;
+        }
+        for (const auto& [key, value] : values.items()) {
+            const bool known = value.is_number() && (technique ? technique->Tune(key, value.get<double>()) : domain->Tune(key, value.get<double>()));
+            if (!known) {
+                std::cerr << where << ": skipped tuning \"" << section << "." << key << "\", expected a number for a constant \"" << section << "\" uses" << '\n';
+                clean = false;
+                continue;
+            }
+            table.Set(section, key, value.get<double>());
+        }
+    }
+    return clean;
+}
+
+void CharacterCreator::LoadTuning(BattleCreator& bc) {
+    if (bc.tuning_path.empty() || !std::filesystem::exists(bc.tuning_path)) return;
+    std::ifstream in(bc.tuning_path);
+    TuningTable table;
+    try {
+        if (!ReadTuning(json::parse(in), table, bc.tuning_path) && bc.interactive) Utilities::WaitForInput();
+    }
+    catch (const json::parse_error& e) {
+        std::cerr << "JSON Parse Error in " << bc.tuning_path << ": " << e.what() << '\n';
+        if (bc.interactive) Utilities::WaitForInput();
+        return;
+    }
+    bc.characterlist.SetTuning(std::move(table));
+}
@@ -0,0 +1,154 @@
+#include "code/header/CharacterCreator/RosterCache.h"
+#include "code/header/GameManagement/MappedFile.h"
+
+namespace {
+    constexpr std::array<char, 4> magic = { 'S', 'S', 'R', 'C' };
+
+    struct Header {
+        std::array<char, 4> magic;
+        std::uint32_t version;
+        std::uint64_t source_size;
+        std::uint64_t source_hash;
+        std::uint32_t count;
+        std::uint32_t reserved;
+    };
+
+    struct Record {
+        std::uint64_t offset;
+        std::uint32_t size;
+        std::uint32_t name_offset;
+        std::uint32_t name_size;
+        std::uint32_t index;
+        std::uint32_t line;
+        std::uint32_t column;
+    };
+
+    static_assert(sizeof(Header) == 32 && sizeof(Record) == 32);
+
+    template<typename T>
+    T ReadAt(std::string_view bytes, size_t offset) {
+        T value;
+        std::memcpy(&value, bytes.data() + offset, sizeof(T));
+        return value;
+    }
+
+    constexpr std::uint64_t prime1 = 0x9E3779B185EBCA87ull;
+    constexpr std::uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr std::uint64_t prime3 = 0x165667B19E3779F9ull;
+
+    std::uint64_t Round(std::uint64_t lane, std::uint64_t word) {
+        return std::rotl(lane + word * prime2, 31) * prime1;
+    }
+
+    // Runs on every warm start, so it reads the roster 32 bytes at a time into
+    // four independent lanes (the xxHash64 round) rather than a byte at a time.
+    // A changed byte anywhere still invalidates the cache.
+    std::uint64_t HashSource(std::string_view source) {
+        const char* p = source.data();
+        const char* const end = p + source.size();
+        std::array<std::uint64_t, 4> lanes = { prime1 + prime2, prime2, 0, 0 - prime1 };
+        for (; end - p >= 32; p += 32) {
+            for (size_t i = 0; i < lanes.size(); i++) lanes[i] = Round(lanes[i], ReadAt<std::uint64_t>({ p, 32 }, i * 8));
+        }
+        std::uint64_t h = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) + std::rotl(lanes[3], 18);
+        for (std::uint64_t lane : lanes) h = (h ^ Round(0, lane)) * prime1 + prime3;
+        h += source.size();
+
+        for (; end - p >= 8; p += 8) h = std::rotl(h ^ Round(0, ReadAt<std::uint64_t>({ p, 8 }, 0)), 27) * prime1 + prime3;
+        for (; p < end; p++) h = std::rotl(h ^ (static_cast<unsigned char>(*p) * prime3), 11) * prime1;
+
+        h = (h ^ (h >> 33)) * prime2;
+        h = (h ^ (h >> 29)) * prime3;
+        return h ^ (h >> 32);
+    }
+
+    bool InBounds(std::string_view bytes, std::uint64_t offset, std::uint64_t size) {
+        return offset <= bytes.size() && size <= bytes.size() - offset;
+    }
+}
+
+std::filesystem::path RosterCache::PathFor(const std::filesystem::path& roster) {
+    std::filesystem::path cache = roster;
+    cache += ".cache";
+    return cache;
+}
+
+bool RosterCache::Read(const std::filesystem::path& path, std::string_view source, const RosterReader::EntryCallback& on_entry) {
+    if constexpr (std::endian::native != std::endian::little) return false;
+
+    MappedFile file(path);
+    if (!file.IsOpen()) return false;
+    std::string_view bytes = file.View();
+    if (bytes.size() < sizeof(Header)) return false;
+
+    const Header header = ReadAt<Header>(bytes, 0);
+    if (header.magic != magic || header.version != version) return false;
+    if (header.source_size != source.size() || header.source_hash != HashSource(source)) return false;
+    if (!InBounds(bytes, sizeof(Header), std::uint64_t{ header.count } * sizeof(Record))) return false;
+
+    // check every range before delivering anything, so a damaged cache is
+    // simply a miss
+    for (size_t i = 0; i < header.count; i++) {
+        const Record r = ReadAt<Record>(bytes, sizeof(Header) + i * sizeof(Record));
+        if (!InBounds(source, r.offset, r.size) || !InBounds(bytes, r.name_offset, r.name_size)) return false;
+    }
+
+    for (size_t i = 0; i < header.count; i++) {
+        const Record r = ReadAt<Record>(bytes, sizeof(Header) + i * sizeof(Record));
+        const RosterSpan span{ .offset = r.offset, .size = r.size, .name = bytes.substr(r.name_offset, r.name_size) };
+        on_entry(span, { .index = r.index, .line = r.line, .column = r.column });
+    }
+    return true;
+}
+
+void RosterCache::Builder::Add(const RosterSpan& span, const RosterPosition& at) {
+    entries.push_back({ .offset = span.offset, .size = span.size, .name_offset = names.size(), .name_size = span.name.size(), .at = at });
+    names += span.name;
+}
+
+bool RosterCache::Builder::Save(const std::filesystem::path& path, std::string_view source) const {
+    if constexpr (std::endian::native != std::endian::little) return false;
+
+    const size_t names_start = sizeof(Header) + entries.size() * sizeof(Record);
+    if (names_start + names.size() > std::numeric_limits<std::uint32_t>::max()) return false;
+
+    const Header header{
+        .magic = magic,
+        .version = version,
+        .source_size = source.size(),
+        .source_hash = HashSource(source),
+        .count = static_cast<std::uint32_t>(entries.size()),
+        .reserved = 0
+    };
+
+    std::filesystem::path temp = path;
+    temp += std::format(".{}.tmp", std::random_device{}());
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        for (const Pending& p : entries) {
+            const Record r{
+                .offset = p.offset,
+                .size = static_cast<std::uint32_t>(p.size),
+                .name_offset = static_cast<std::uint32_t>(names_start + p.name_offset),
+                .name_size = static_cast<std::uint32_t>(p.name_size),
+                .index = static_cast<std::uint32_t>(p.at.index),
+                .line = static_cast<std::uint32_t>(p.at.line),
+                .column = static_cast<std::uint32_t>(p.at.column)
+            };
+            out.write(reinterpret_cast<const char*>(&r), sizeof(r));
+        }
+        out.write(names.data(), static_cast<std::streamsize>(names.size()));
+        if (!out) {
+            out.close();
+            std::error_code ignored;
+            std::filesystem::remove(temp, ignored);
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(temp, path, ec);
+    if (ec) std::filesystem::remove(temp, ec);
+    return !ec;
+}
@@ -0,0 +1,87 @@
+#include "code/header/CharacterCreator/RosterIndex.h"
+#include "code/header/CharacterCreator/CharacterCreator.h"
+#include "code/header/GameManagement/MappedFile.h"
+
+RosterIndex::RosterIndex() = default;
+RosterIndex::~RosterIndex() = default;
+RosterIndex::RosterIndex(RosterIndex&&) noexcept = default;
+RosterIndex& RosterIndex::operator=(RosterIndex&&) noexcept = default;
+
+void RosterIndex::Clear() {
+    entries.clear();
+    sources.clear();
+    tuning = {};
+}
+
+void RosterIndex::SetTuning(TuningTable table) {
+    tuning = std::move(table);
+}
+
+void RosterIndex::Add(std::unique_ptr<Character> character) {
+    Entry entry;
+    tuning.Apply(*character);
+    entry.name = character->GetSimpleName();
+    entry.character = std::move(character);
+    entries.push_back(std::move(entry));
+}
+
+size_t RosterIndex::AddSource(std::string path, std::unique_ptr<MappedFile> file) {
+    sources.push_back({ std::move(path), std::move(file) });
+    return sources.size() - 1;
+}
+
+void RosterIndex::AddEntry(size_t source, const RosterSpan& span, const RosterPosition& at) {
+    entries.push_back({ .name = std::string(span.name), .character = nullptr, .source = source, .offset = span.offset, .size = span.size, .at = at });
+}
+
+size_t RosterIndex::Size() const {
+    return entries.size();
+}
+
+const std::string& RosterIndex::Name(size_t i) const {
+    return entries[i].name;
+}
+
+bool RosterIndex::Materialize(Entry& entry) {
+    if (entry.character) return true;
+    const Source& source = sources[entry.source];
+    const char* text = source.file->View().data() + entry.offset;
+    try {
+        CharacterCreator creator(&tuning);
+        entry.character = creator.CreateJsonObject(json::parse(text, text + entry.size));
+    }
+    catch (const json::exception& e) {
+        std::cerr << source.path << ":" << entry.at.line << ":" << entry.at.column << ": skipped character " << entry.at.index << ": " << e.what() << '\n';
+    }
+    return entry.character != nullptr;
+}
+
+const Character* RosterIndex::Build(std::string_view name) {
+    for (size_t i = 0; i < entries.size();) {
+        if (entries[i].name != name) {
+            i++;
+            continue;
+        }
+        if (Materialize(entries[i])) return entries[i].character.get();
+        entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(i));
+    }
+    return nullptr;
+}
+
+bool RosterIndex::BuildAll() {
+    bool all = true;
+    for (Entry& entry : entries) all &= Materialize(entry);
+    if (!all) std::erase_if(entries, [](const Entry& entry) { return !entry.character; });
+    return all;
+}
+
+const Character* RosterIndex::Find(std::string_view name) const {
+    for (const Entry& entry : entries) {
+        if (entry.name == name) return entry.character.get();
+    }
+    return nullptr;
+}
+
+const Character* RosterIndex::At(size_t i) const {
+    return entries[i].character.get();
+}
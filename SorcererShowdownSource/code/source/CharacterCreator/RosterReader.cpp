@@ -0,0 +1,198 @@
+#include "code/header/CharacterCreator/RosterReader.h"
+#include "json.hpp"
+
+using json = nlohmann::json;
+
+namespace {
+    // Walks the text for json.hpp's lexer and remembers the last character it
+    // read, which is how the SAX events below find out where they are.
+    struct TrackingIterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = char;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const char*;
+        using reference = const char&;
+
+        const char* at = nullptr;
+        const char** last_read = nullptr;
+
+        reference operator*() const {
+            *last_read = at;
+            return *at;
+        }
+        TrackingIterator& operator++() {
+            ++at;
+            return *this;
+        }
+        TrackingIterator operator++(int) {
+            TrackingIterator before = *this;
+            ++at;
+            return before;
+        }
+        bool operator==(const TrackingIterator& other) const { return at == other.at; }
+    };
+
+    class RosterSax {
+        const RosterReader::EntryCallback& on_entry;
+        std::string& error;
+
+        // containers open outside any entry: 1 is the root object, 2 the
+        // "characters" array when in_characters is set
+        size_t depth = 0;
+        bool characters_key = false;
+        bool in_characters = false;
+        bool saw_characters = false;
+
+        // a root object without a "characters" key is a single character,
+        // delivered as entry 0 when it closes
+        size_t root_start = 0;
+        RosterPosition root_position;
+        bool root_object = false;
+        bool root_name_key = false;
+        std::string root_name;
+
+        // containers open in the current entry, and what its top level has
+        // said so far about its name
+        size_t entry_depth = 0;
+        bool entry_object = false;
+        bool name_key = false;
+        std::string name;
+
+        const char* const begin;
+        const char* const& last_read;
+        const char* counted;
+        const char* line_start;
+        size_t entry_start = 0;
+        RosterPosition position;
+
+        void MarkEntryStart() {
+            for (; counted < last_read; counted++) {
+                if (*counted == '\n') {
+                    position.line++;
+                    line_start = counted + 1;
+                }
+            }
+            position.column = static_cast<size_t>(last_read - line_start) + 1;
+            entry_start = static_cast<size_t>(last_read - begin);
+        }
+
+        void Deliver(size_t size) {
+            on_entry({ .offset = entry_start, .size = size, .name = name }, position);
+            position.index++;
+            name.clear();
+        }
+
+        bool Value(json::string_t* text = nullptr) {
+            if (entry_depth > 0) {
+                if (entry_depth == 1 && name_key) {
+                    if (text) name = std::move(*text);
+                    else name.clear();
+                }
+                name_key = false;
+            }
+            else if (in_characters && depth == 2) {
+                MarkEntryStart();
+                Deliver(0);
+            }
+            else if (depth == 1) {
+                if (root_name_key) {
+                    if (text) root_name = std::move(*text);
+                    else root_name.clear();
+                }
+                root_name_key = false;
+            }
+            return true;
+        }
+
+        bool StartContainer(bool object) {
+            if (entry_depth > 0) {
+                if (entry_depth == 1 && name_key) name.clear();
+                name_key = false;
+                entry_depth++;
+                return true;
+            }
+            if (in_characters && depth == 2) {
+                MarkEntryStart();
+                entry_depth = 1;
+                entry_object = object;
+                return true;
+            }
+            if (depth == 0 && object) {
+                MarkEntryStart();
+                root_start = entry_start;
+                root_position = position;
+                root_object = true;
+            }
+            if (depth == 1) {
+                if (root_name_key) root_name.clear();
+                root_name_key = false;
+            }
+            depth++;
+            if (depth == 2 && characters_key && !object) in_characters = true;
+            return true;
+        }
+
+        bool EndContainer() {
+            if (entry_depth > 0) {
+                if (--entry_depth == 0) {
+                    Deliver(entry_object ? static_cast<size_t>(last_read - begin) + 1 - entry_start : 0);
+                }
+                return true;
+            }
+            if (depth == 2) in_characters = false;
+            if (depth == 1 && root_object && !saw_characters) {
+                entry_start = root_start;
+                position = root_position;
+                name = std::move(root_name);
+                Deliver(static_cast<size_t>(last_read - begin) + 1 - entry_start);
+            }
+            depth--;
+            return true;
+        }
+    public:
+        RosterSax(const RosterReader::EntryCallback& callback, std::string& err, const char* text, const char* const& cursor) :
+            on_entry(callback),
+            error(err),
+            begin(text),
+            last_read(cursor),
+            counted(text),
+            line_start(text) {
+        }
+
+        bool null() { return Value(); }
+        bool boolean(bool) { return Value(); }
+        bool number_integer(json::number_integer_t) { return Value(); }
+        bool number_unsigned(json::number_unsigned_t) { return Value(); }
+        bool number_float(json::number_float_t, const json::string_t&) { return Value(); }
+        bool string(json::string_t& val) { return Value(&val); }
+        bool binary(json::binary_t&) { return Value(); }
+
+        bool start_object(std::size_t) { return StartContainer(true); }
+        bool end_object() { return EndContainer(); }
+        bool start_array(std::size_t) { return StartContainer(false); }
+        bool end_array() { return EndContainer(); }
+
+        bool key(json::string_t& val) {
+            if (entry_depth == 1) name_key = val == "name";
+            else if (entry_depth == 0 && depth == 1) {
+                characters_key = val == "characters";
+                saw_characters |= characters_key;
+                root_name_key = val == "name";
+            }
+            return true;
+        }
+
+        bool parse_error(std::size_t, const std::string&, const nlohmann::detail::exception& ex) {
+            error = ex.what();
+            return false;
+        }
+    };
+}
+
+bool RosterReader::Read(std::string_view text, const EntryCallback& on_entry, std::string& error) {
+    const char* last_read = text.data();
+    RosterSax sax(on_entry, error, text.data(), last_read);
+    TrackingIterator first{ text.data(), &last_read };
+    TrackingIterator last{ text.data() + text.size(), &last_read };
+    return json::sax_parse(first, last, &sax);
+}
@@ -0,0 +1,39 @@
+#include "code/header/CharacterCreator/TuningTable.h"
+#include "code/header/Characters/CurseUsers/CurseUser.h"
+#include "code/header/Techniques/Techniques.h"
+#include "code/header/Domains/Domain.h"
+
+void TuningTable::Set(std::string_view section, std::string_view key, double value) {
+    auto s = std::ranges::find(sections, section, &Section::name);
+    if (s == sections.end()) {
+        sections.push_back({ std::string(section), {} });
+        s = sections.end() - 1;
+    }
+    auto v = std::ranges::find(s->values, key, &std::pair<std::string, double>::first);
+    if (v != s->values.end()) v->second = value;
+    else s->values.emplace_back(key, value);
+}
+
+bool TuningTable::Empty() const {
+    return sections.empty();
+}
+
+void TuningTable::ApplyTo(Technique& technique) const {
+    auto s = std::ranges::find(sections, technique.RosterName(), &Section::name);
+    if (s == sections.end()) return;
+    for (const auto& [key, value] : s->values) technique.Tune(key, value);
+}
+
+void TuningTable::ApplyTo(Domain& domain) const {
+    auto s = std::ranges::find(sections, domain.RosterName(), &Section::name);
+    if (s == sections.end()) return;
+    for (const auto& [key, value] : s->values) domain.Tune(key, value);
+}
+
+void TuningTable::Apply(Character& character) const {
+    if (sections.empty() || !character.IsaCurseUser()) return;
+    auto& user = static_cast<CurseUser&>(character);
+    if (Technique* technique = user.GetTechnique()) ApplyTo(*technique);
+    if (Domain* domain = user.GetDomain()) ApplyTo(*domain);
+    if (Domain* counter = user.GetCounterDomain()) ApplyTo(*counter);
+}
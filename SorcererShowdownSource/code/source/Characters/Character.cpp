@@ -14,23 +14,23 @@
 
 
 
-int Character::global_id_counter = 0;
-
-Character::Character(double hp)
-	: health(hp),max_health(hp),previous_health(hp){
+Character::Character(double hp) {
+	Stat(HotStat::Health) = hp;
+	Stat(HotStat::MaxHealth) = hp;
+	Stat(HotStat::PreviousHealth) = hp;
 }
 Character::~Character() = default;
 
 void Character::OnCharacterTurn(Battlefield& bf) {
 	if (this->IsCharacterStunned()) {
-		std::println("{} is stunned and their turn will be skipped", this->GetNameWithID());
+		NARRATE(this->Out(), "{} is stunned and their turn will be skipped", this->GetNameWithID());
 		return;
 	}
 	if (brain) {
 		brain->ExecuteTurn(this, bf);
 	}
 	else {
-		std::println("if you see this, it means that you havent assigned"
+		NARRATE(this->Out(), "if you see this, it means that you havent assigned"
 					 "an AI type to this character, you must add it in the JSON file");
 	}
 }
@@ -40,24 +40,55 @@ bool Character::CanBeAssignedID() const {
 }
 
 void Character::Attack(Character*) {
-	std::println("this is not supposed to be reached"
+	NARRATE(this->Out(), "this is not supposed to be reached"
 				 "i realized it way too late"
 				 "characters with their chosen types use their own attack function");
 }
 
-void Character::AssignID() {
+void Character::JoinBattle(BattleContext& battle) {
+	context = &battle;
 	if (CanBeAssignedID()) {
-		global_id_counter++;
-		unique_id = global_id_counter;
+		unique_id = battle.NextID();
+		rng = battle.CharacterStream(unique_id);
 	}
 }
 
+BattleContext* Character::GetContext() const {
+	return context;
+}
+
+void Character::AttachStats(FighterStats& table) {
+	stat_slot = table.Add(own_stats);
+	stats = &table;
+}
+
+size_t Character::GetStatSlot() const {
+	return stat_slot;
+}
+
+void Character::SetStatSlot(size_t slot) {
+	stat_slot = slot;
+}
+
+BattleRandom& Character::GetRandom() const {
+	return rng;
+}
+
+OutputSink& Character::Out() const {
+	return context ? context->Out() : OutputSink::Stdout();
+}
+
+std::pmr::memory_resource* Character::Scratch() const {
+	return context ? &context->Scratch() : std::pmr::get_default_resource();
+}
+
 bool Character::IsThePlayer() const {
 	return is_player;
 }
 
 void Character::SetAsPlayer(bool p) {
 	is_player = p;
+	if (context) context->Index().SetPlayer(this, p);
 }
 
 void Character::SetVulnerability(bool t) {
@@ -69,12 +100,32 @@ double Character::GetBaseAttackDamage() const {
 }
 
 void Character::SetHealth(double h) {
+	double& health = Stat(HotStat::Health);
+	double before = health;
 	health = h;
+	TrackHealth(before);
 }
 
 void Character::SetCharacterName(std::string name, std::string color) {
-	char_name = name;
-	name_color = color;
+	CharacterDefinition& def = EditDefinition();
+	def.name = std::move(name);
+	def.color = std::move(color);
+	def.RenderLabel();
+}
+
+const CharacterDefinition& Character::Definition() const {
+	return *definition;
+}
+
+void Character::ShareDefinition(const Character& entry) {
+	definition = entry.definition;
+}
+
+// Copy on write: a definition still shared with another fighter (or with a
+// static one) is copied before it is changed.
+CharacterDefinition& Character::EditDefinition() {
+	if (definition.use_count() != 1) definition = std::make_shared<CharacterDefinition>(*definition);
+	return const_cast<CharacterDefinition&>(*definition);
 }
 
 void Character::AddToolToInventory(std::unique_ptr<CursedTool> tool) {
@@ -83,10 +134,6 @@ void Character::AddToolToInventory(std::unique_ptr<CursedTool> tool) {
 	}
 }
 
-bool Character::CanBeHit() const {
-	return true;
-}
-
 std::unique_ptr<Character> Character::Clone() const {
 	return nullptr;
 }
@@ -95,19 +142,49 @@ double Character::GetDamageReinforcement()const { return 1.0; }
 
 void Character::Damage(double h) {
 	if (!CanBeHit() || is_invulnerable) return;
+	double& health = Stat(HotStat::Health);
+	double before = health;
 	health = std::max(health - (h / GetDamageReinforcement()), 0.0);
+	RecordDamage(BattleEvent::DamageKind::Normal, before);
 }
 void Character::DamageBypassReinforcement(double h) {
 	if (is_invulnerable || !CanBeHit()) return;
+	double& health = Stat(HotStat::Health);
+	double before = health;
 	health = std::max(health - h, 0.0);
+	RecordDamage(BattleEvent::DamageKind::BypassReinforcement, before);
 }
 void Character::DamageBypass(double h) {
 	if (is_invulnerable) return;
+	double& health = Stat(HotStat::Health);
+	double before = health;
 	health = std::max(health - (h / GetDamageReinforcement()), 0.0);
+	RecordDamage(BattleEvent::DamageKind::Bypass, before);
 }
 void Character::DamageBypassAll(double h) {
 	if (is_invulnerable) return;
+	double& health = Stat(HotStat::Health);
+	double before = health;
 	health = std::max(health - h, 0.0);
+	RecordDamage(BattleEvent::DamageKind::BypassAll, before);
+}
+
+void Character::RecordDamage(BattleEvent::DamageKind kind, double health_before) {
+	const double health = Stat(HotStat::Health);
+	TrackHealth(health_before);
+	if (!context || !context->Events().Listening() || health >= health_before) return;
+	EventStream& events = context->Events();
+	events.Emit({ .type = BattleEvent::Type::Damage, .damage = kind, .source = events.Actor(), .target = unique_id, .amount = health_before - health });
+}
+
+void Character::TrackHealth(double health_before) {
+	const double health = Stat(HotStat::Health);
+	if (context && (health_before > 0.0) != (health > 0.0)) context->Index().HealthChanged(this, health > 0.0);
+}
+
+void Character::RecordEvent(const BattleEvent& event) const {
+	if (!context || !context->Events().Listening()) return;
+	context->Events().Emit(event);
 }
 
 
@@ -116,30 +193,36 @@ void Character::SetBaseDamage(double d) {
 }
 
 void Character::Regen(double h) {
-	health = std::min(health + h, max_health);
+	double& health = Stat(HotStat::Health);
+	double before = health;
+	health = std::min(health + h, Stat(HotStat::MaxHealth));
+	TrackHealth(before);
+	if (health > before && context && context->Events().Listening()) {
+		context->Events().Emit({ .type = BattleEvent::Type::Heal, .source = context->Events().Actor(), .target = unique_id, .amount = health - before });
+	}
 }
 
 double Character::GetCharacterHealth() const {
-    return health;
+    return Stat(HotStat::Health);
 }
 double Character::GetCharacterMaxHealth() const {
-	return max_health;
+	return Stat(HotStat::MaxHealth);
 }
 
 double Character::GetCharacterPreviousHealth() const {
-	return previous_health;
+	return Stat(HotStat::PreviousHealth);
 }
 
 void Character::SetStunState(bool s) {
-	is_stunned = s;
+	SetFlag(StunnedOn, s);
 }
 
 void Character::UpdatePreviousHP() {
-	previous_health = health;
+	Stat(HotStat::PreviousHealth) = Stat(HotStat::Health);
 }
 
 bool Character::IsCharacterStunned() const {
-	return is_stunned;
+	return flags & StunnedOn;
 }
 
 bool Character::HPMoreThanMax(double h) const {
@@ -147,15 +230,15 @@ bool Character::HPMoreThanMax(double h) const {
 }
 
 std::string Character::GetName() const {
-	return std::format("{}{}{}", name_color, char_name, Utilities::Color::Clear);
+	return definition->label;
 }
 std::string Character::GetSimpleName() const {
-	return char_name;
+	return definition->name;
 }
 
 void Character::ClearStunTime() {
 	if (stun_duration <= 0) {
-		is_stunned = false;
+		SetFlag(StunnedOn, false);
 		stun_duration = 2;
 	}
 	else {
@@ -168,29 +251,19 @@ int Character::GetID() const {
 }
 
 std::string Character::GetNameWithID()const {
-	return std::format("{}{}{} ({})",name_color ,char_name, Utilities::Color::Clear, unique_id);
+	return std::format("{} ({})", definition->label, unique_id);
 }
 
-bool Character::IsaSorcerer() const {
-	return false;
-}
-bool Character::IsShikigami() const {
-	return false;
-}
-bool Character::IsPhysicallyGifted() const {
-	return false;
-}
-bool Character::IsaCurseUser() const {
-	return false;
-}
-bool Character::IsaCursedSpirit() const {
-	return false;
+ScratchString Character::GetNameWithID(std::pmr::memory_resource* memory) const {
+	ScratchString out(memory);
+	std::format_to(std::back_inserter(out), "{} ({})", definition->label, unique_id);
+	return out;
 }
 
 void Character::CursedToolChoice(size_t choice) {
 	if (choice == 0) {
 		if (cursed_tool != nullptr) {
-			std::println("{}{} put {} away.{}", Utilities::Color::BrightRed, this->GetNameWithID(), cursed_tool->GetName(), Utilities::Color::Clear);
+			NARRATE(this->Out(), "{}{} put {} away.{}", Utilities::Color::BrightRed, this->GetNameWithID(), cursed_tool->GetName(), Utilities::Color::Clear);
 			inventory_curse.push_back(std::move(cursed_tool));
 			cursed_tool = nullptr;
 		}
@@ -205,10 +278,10 @@ void Character::CursedToolChoice(size_t choice) {
 		cursed_tool = std::move(inventory_curse[inv_index]);
 		inventory_curse.erase(inventory_curse.begin() + static_cast<std::ptrdiff_t>(inv_index));
 
-		std::println("{}{} equipped {}!{}", Utilities::Color::Cyan, this->GetNameWithID(), cursed_tool->GetName(), Utilities::Color::Clear);
+		NARRATE(this->Out(), "{}{} equipped {}!{}", Utilities::Color::Cyan, this->GetNameWithID(), cursed_tool->GetName(), Utilities::Color::Clear);
 	}
 	else {
-		std::println("{}Invalid tool choice.{}", Utilities::Color::Red, Utilities::Color::Clear);
+		NARRATE(this->Out(), "{}Invalid tool choice.{}", Utilities::Color::Red, Utilities::Color::Clear);
 	}
 }
 
@@ -236,39 +309,39 @@ void Character::Taunt(Character* taunted) const {
     const bool healthy = this->HPMoreThanMax(0.70);
     const bool injured = this->HPMoreThanMax(0.50);
     const bool critical = this->HPMoreThanMax(0.25);
-	std::string target = taunted->GetNameWithID();
-    int type = Utilities::GetRandomNumber(1, 4);
+	ScratchString target = taunted->GetNameWithID(Scratch());
+    int type = this->GetRandom().Next(1, 4);
 
     if (healthy) {
         switch (type) {
-            case 1: std::println("Stand proud, {}. You're strong.", target); break;
-            case 2: std::println("Are you the challenger because you're {}, or are you {} because you're the challenger?", target, target); break;
-            case 3: std::println("You're just a nameless fish on my cutting board, {}.", target); break;
-            default: std::println("You really thought you were the one who would win, {}?", target);
+            case 1: NARRATE(this->Out(), "Stand proud, {}. You're strong.", target); break;
+            case 2: NARRATE(this->Out(), "Are you the challenger because you're {}, or are you {} because you're the challenger?", target, target); break;
+            case 3: NARRATE(this->Out(), "You're just a nameless fish on my cutting board, {}.", target); break;
+            default: NARRATE(this->Out(), "You really thought you were the one who would win, {}?", target);
         }
     }
     else if (injured) {
         switch (type) {
-            case 1: std::println("You're starting to see it, aren't you, {}? The core of Cursed Energy!", target); break;
-            case 2: std::println("I'll have to adjust my evaluation of you, {}.", target); break;
-            case 3: std::println("Don't get cocky, {}. You haven't even forced me to use my technique yet.", target); break;
-            default: std::println("You're actually making me work for this, {}.", target);
+            case 1: NARRATE(this->Out(), "You're starting to see it, aren't you, {}? The core of Cursed Energy!", target); break;
+            case 2: NARRATE(this->Out(), "I'll have to adjust my evaluation of you, {}.", target); break;
+            case 3: NARRATE(this->Out(), "Don't get cocky, {}. You haven't even forced me to use my technique yet.", target); break;
+            default: NARRATE(this->Out(), "You're actually making me work for this, {}.", target);
         }
     }
     else if (critical) {	
         switch (type) {
-            case 1: std::println("Is this the 'spark' you were hoping for, {}?", target); break;
-            case 2: std::println("This is true Sorcery! Don't you dare look away, {}!", target); break;
-            case 3: std::println("You've peeled back my scales, {}. Now see what's underneath!", target); break;
-            default: std::println("You're really pushing your luck now, {}!", target);
+            case 1: NARRATE(this->Out(), "Is this the 'spark' you were hoping for, {}?", target); break;
+            case 2: NARRATE(this->Out(), "This is true Sorcery! Don't you dare look away, {}!", target); break;
+            case 3: NARRATE(this->Out(), "You've peeled back my scales, {}. Now see what's underneath!", target); break;
+            default: NARRATE(this->Out(), "You're really pushing your luck now, {}!", target);
         }
     }
     else {
         switch (type) {
-            case 1: std::println("Even compared to you, {}, I alone am the honored one.", target); break;
-            case 2: std::println("Even if I die, my curse will haunt you forever, {}!", target); break;
-			case 3: std::println("To merit the title of 'Sorcerer' you'll have to do better than that, {}.", target); break;
-            default: std::println("You're just a monkey who can't even finish the job, {}!", target);
+            case 1: NARRATE(this->Out(), "Even compared to you, {}, I alone am the honored one.", target); break;
+            case 2: NARRATE(this->Out(), "Even if I die, my curse will haunt you forever, {}!", target); break;
+			case 3: NARRATE(this->Out(), "To merit the title of 'Sorcerer' you'll have to do better than that, {}.", target); break;
+            default: NARRATE(this->Out(), "You're just a monkey who can't even finish the job, {}!", target);
         }
     }
 }
@@ -0,0 +1,16 @@
+#include "code/header/Characters/CharacterDefinition.h"
+#include "code/header/GameManagement/Utils.h"
+
+void CharacterDefinition::RenderLabel() {
+	label = std::format("{}{}{}", color, name, Utilities::Color::Clear);
+}
+
+std::shared_ptr<const CharacterDefinition> CharacterDefinition::Make(CharacterDefinition definition) {
+	definition.RenderLabel();
+	return std::make_shared<CharacterDefinition>(std::move(definition));
+}
+
+const std::shared_ptr<const CharacterDefinition>& CharacterDefinition::Default() {
+	static const std::shared_ptr<const CharacterDefinition> definition = Make({});
+	return definition;
+}
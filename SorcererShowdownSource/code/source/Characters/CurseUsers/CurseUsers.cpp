@@ -12,17 +12,19 @@ CurseUser::~CurseUser() = default;
 
 CurseUser::CurseUser(double hp, double ce, double re) : 
     Character(hp),
-    cursed_energy(ce),
-    max_cursed_energy(ce),
-    prev_cursed_energy(ce),
-    ce_regen(re),
-    saved_ce_regen(re),
-    max_ce_reinforcement(200.0),
-    current_ce_reinforcement(50.0){ // this is clamped in the setter so it wont cause issues
+    saved_ce_regen(re) {
+    Stat(HotStat::CursedEnergy) = ce;
+    Stat(HotStat::MaxCursedEnergy) = ce;
+    Stat(HotStat::PreviousCE) = ce;
+    Stat(HotStat::CERegen) = re;
+    Stat(HotStat::MaxReinforcement) = 200.0;
+    Stat(HotStat::Reinforcement) = 50.0; // this is clamped in the setter so it wont cause issues
+    flags |= KindCurseUser;
+    hit_blockers = InfinityOn;
 }
 
 bool CurseUser::DomainActive() const {
-    return domain_active;
+    return flags & DomainOn;
 }
 
 Shikigami* CurseUser::ChooseShikigami(size_t index)  const {
@@ -61,34 +63,43 @@ void CurseUser::SetAmplification(bool t) {
 }
 
 void CurseUser::SetCursedEnergy(double c) {
-    cursed_energy = c;
+    Stat(HotStat::CursedEnergy) = c;
 }
 
 void CurseUser::SetMaxCursedEnergy(double c) {
-    max_cursed_energy = c;
+    Stat(HotStat::MaxCursedEnergy) = c;
 }
 
 void CurseUser::SetCursedEnergyRegen(double c) {
-    ce_regen = c;
+    Stat(HotStat::CERegen) = c;
 }
 double CurseUser::GetCharacterCE() const {
-    return cursed_energy;
+    return Stat(HotStat::CursedEnergy);
 }
 
 void CurseUser::SpendCE(double c) {
+    double& cursed_energy = Stat(HotStat::CursedEnergy);
+    double before = cursed_energy;
     cursed_energy = std::max(cursed_energy - c, 0.0);
+    RecordCESpent(before);
+}
+
+void CurseUser::RecordCESpent(double ce_before) {
+    const double cursed_energy = Stat(HotStat::CursedEnergy);
+    if (cursed_energy >= ce_before) return;
+    RecordEvent({ .type = BattleEvent::Type::CESpent, .source = unique_id, .target = unique_id, .amount = ce_before - cursed_energy });
 }
 
 void CurseUser::RegenCE() {
-    cursed_energy = std::min(cursed_energy + ce_regen, max_cursed_energy);
+    Stat(HotStat::CursedEnergy) = std::min(Stat(HotStat::CursedEnergy) + Stat(HotStat::CERegen), Stat(HotStat::MaxCursedEnergy));
 }
 
 double CurseUser::GetCEregen() const {
-    return ce_regen;
+    return Stat(HotStat::CERegen);
 }
 
 double CurseUser::GetCharacterMaxCE() const {
-    return max_cursed_energy;
+    return Stat(HotStat::MaxCursedEnergy);
 }
 
 bool CurseUser::CEMoreThanMax(double c) const {
@@ -96,42 +107,44 @@ bool CurseUser::CEMoreThanMax(double c) const {
 }
 
 double CurseUser::GetReinforcement() const {
-    return current_ce_reinforcement;
+    return Stat(HotStat::Reinforcement);
 }
 double CurseUser::GetMaxReinforcement()const {
-    return max_ce_reinforcement;
+    return Stat(HotStat::MaxReinforcement);
 }
 
 double CurseUser::GetDamageReinforcement()const {
-    if (max_ce_reinforcement <= 0.0) return 1.0;
-    return 1.0 + ((current_ce_reinforcement / max_ce_reinforcement) * 2);
+    const double max_reinforcement = Stat(HotStat::MaxReinforcement);
+    if (max_reinforcement <= 0.0) return 1.0;
+    return 1.0 + ((Stat(HotStat::Reinforcement) / max_reinforcement) * 2);
 }
 
 void CurseUser::SetCurrentReinforcement(double r) {
-    current_ce_reinforcement = std::clamp(r, 0.0, max_ce_reinforcement);
+    Stat(HotStat::Reinforcement) = std::clamp(r, 0.0, Stat(HotStat::MaxReinforcement));
 }
 void CurseUser::SetMaxReinforcement(double max) {
-    max_ce_reinforcement = max;
-    if (current_ce_reinforcement > max_ce_reinforcement) {
-        current_ce_reinforcement = max_ce_reinforcement;
+    Stat(HotStat::MaxReinforcement) = max;
+    double& reinforcement = Stat(HotStat::Reinforcement);
+    if (reinforcement > max) {
+        reinforcement = max;
     }
 }
 void CurseUser::AddReinforcement(double r) {
-    current_ce_reinforcement = std::clamp(current_ce_reinforcement + r, 0.0, max_ce_reinforcement);
+    Stat(HotStat::Reinforcement) = std::clamp(Stat(HotStat::Reinforcement) + r, 0.0, Stat(HotStat::MaxReinforcement));
 }
 
 void CurseUser::TickReinforcement() {
-    if (current_ce_reinforcement <= 0.0) return;
-    double maintain_cost = current_ce_reinforcement * 1.5;
+    if (Stat(HotStat::Reinforcement) <= 0.0) return;
+    double maintain_cost = Stat(HotStat::Reinforcement) * 1.5;
     this->SpendCE(maintain_cost);
     if (this->GetCharacterCE() < this->GetReinforcement()) {
-        current_ce_reinforcement = 0.0;
-        std::println("{}'s CE reinforcement collapsed due to a lack of Cursed Energy!", this->GetName());
+        Stat(HotStat::Reinforcement) = 0.0;
+        NARRATE(this->Out(), "{}'s CE reinforcement collapsed due to a lack of Cursed Energy!", this->GetName());
     }
 }
 
 std::string CurseUser::GetDomainStatus()const {
-    if (domain_active) return "\033[35mActive\033[0m";
+    if (DomainActive()) return "\033[35mActive\033[0m";
     else return "\033[2;90mInactive\033[0m";
 }
 
@@ -147,18 +160,19 @@ std::string CurseUser::GetDAstatus() const {
 }
 
 std::string CurseUser::GetCounterStatus() const {
-    if (counter_domain_active) return std::format("{}Active{}", Utilities::Color::Purple, Utilities::Color::Clear);
+    if (CounterDomainActive()) return std::format("{}Active{}", Utilities::Color::Purple, Utilities::Color::Clear);
     return std::format("{}Inactive{}", Utilities::Color::Red, Utilities::Color::Clear);
 }
 
 void CurseUser::UpdatePreviousCE() {
-    prev_cursed_energy = cursed_energy;
+    Stat(HotStat::PreviousCE) = Stat(HotStat::CursedEnergy);
 }
 
 std::string CurseUser::GetReinforcementStatus() const {
     std::string currentcolor = Utilities::Color::Yellow;
     std::string clear = Utilities::Color::Clear;
 
+    const double current_ce_reinforcement = Stat(HotStat::Reinforcement);
     if (current_ce_reinforcement < this->GetMaxReinforcement() * 0.25) {
         currentcolor = Utilities::Color::Red;
     }
@@ -174,11 +188,14 @@ std::string CurseUser::GetReinforcementStatus() const {
     else {
         currentcolor = Utilities::Color::Purple;
     }
-    return std::format("{}{:.1f}/{:.1f}{}", currentcolor, current_ce_reinforcement, max_ce_reinforcement, clear);
+    return std::format("{}{:.1f}/{:.1f}{}", currentcolor, current_ce_reinforcement, Stat(HotStat::MaxReinforcement), clear);
 }
 
 void CurseUser::SpendCEdirect(double ce) {
+    double& cursed_energy = Stat(HotStat::CursedEnergy);
+    double before = cursed_energy;
     cursed_energy = std::max(cursed_energy - ce, 0.0);
+    RecordCESpent(before);
 }
 
 void CurseUser::TickZone() {
@@ -187,10 +204,10 @@ void CurseUser::TickZone() {
     if (!this->DomainActive() && this->GetTechnique()->GetStatus() == Technique::Status::DomainBoost) {
         the_zone_time++;
         if (!zone_ce_boost) {
-            this->SetCursedEnergyRegen(ce_regen + 50.0);
+            this->SetCursedEnergyRegen(Stat(HotStat::CERegen) + 50.0);
             zone_ce_boost = true;
         }
-        if (the_zone_time > max_zone_time) {
+        if (the_zone_time > definition->max_zone_time) {
             this->GetTechnique()->Set(Technique::Status::Usable);
             the_zone_time = 0;
         }
@@ -207,11 +224,11 @@ void CurseUser::TickZone() {
 void CurseUser::TickDomain() {
     if (this->DomainActive()) {
         active_domain_time++;
-        if (active_domain_time == max_domain_time) {
-            std::println("{}'s domain will end soon", this->GetNameWithID());
+        if (active_domain_time == definition->max_domain_time) {
+            NARRATE(this->Out(), "{}'s domain will end soon", this->GetNameWithID());
         }
-        else if (active_domain_time > max_domain_time) {
-            std::println("{}'s domain has been deactivated after reaching its timed limit!", this->GetNameWithID());
+        else if (active_domain_time > definition->max_domain_time) {
+            NARRATE(this->Out(), "{}'s domain has been deactivated after reaching its timed limit!", this->GetNameWithID());
             this->DeactivateDomain();
             this->GetDomain()->CollapseDomain();
             active_domain_time = 0;
@@ -219,11 +236,11 @@ void CurseUser::TickDomain() {
     }
     if (this->CounterDomainActive()) {
         active_counter_time++;
-        if (active_counter_time == max_counter_time) {
-            std::println("{}'s {}{}{} is about to shatter", this->GetNameWithID(), Utilities::Color::Cyan, this->GetCounterDomain()->GetDomainName(), Utilities::Color::Clear);
+        if (active_counter_time == definition->max_counter_time) {
+            NARRATE(this->Out(), "{}'s {}{}{} is about to shatter", this->GetNameWithID(), Utilities::Color::Cyan, this->GetCounterDomain()->GetDomainName(), Utilities::Color::Clear);
         }
-        else if (active_counter_time > max_counter_time) {
-            std::println("{}'s {}{}{} has been {}shattered{}!", this->GetNameWithID(), Utilities::Color::Cyan, this->GetCounterDomain()->GetDomainName(), Utilities::Color::Clear, Utilities::Color::Red, Utilities::Color::Clear);
+        else if (active_counter_time > definition->max_counter_time) {
+            NARRATE(this->Out(), "{}'s {}{}{} has been {}shattered{}!", this->GetNameWithID(), Utilities::Color::Cyan, this->GetCounterDomain()->GetDomainName(), Utilities::Color::Clear, Utilities::Color::Red, Utilities::Color::Clear);
             this->DeactivateCounterDomain();
             counter_on_cooldown = true;
             active_counter_time = 0;
@@ -237,7 +254,7 @@ void CurseUser::TickDomain() {
         }
         if (counter_on_cooldown) {
             counter_recover_time++;
-            if (counter_recover_time >= max_counter_cooldown) {
+            if (counter_recover_time >= definition->max_counter_cooldown) {
                 counter_on_cooldown = false;
                 counter_recover_time = 0;
             }
@@ -245,33 +262,34 @@ void CurseUser::TickDomain() {
     }
 }
 
-bool CurseUser::IsaCurseUser() const {
-    return true;
-}
-
 void CurseUser::ActivateDomain() {
     if (!domain) {
-        std::println("You don't have a domain to activate!");
+        NARRATE(this->Out(), "You don't have a domain to activate!");
         return;
     }
-    else if (domain_active) {
-        std::println("Your domain is already active!");
+    else if (DomainActive()) {
+        NARRATE(this->Out(), "Your domain is already active!");
         return;
     }
     else if (is_strained) {
-        std::println("Your brain is {}strained!{} You cannot use your domain for now...", Utilities::Color::Red, Utilities::Color::Clear);
+        NARRATE(this->Out(), "Your brain is {}strained!{} You cannot use your domain for now...", Utilities::Color::Red, Utilities::Color::Clear);
         return;
     }
-    else if (total_domain_uses >= domain_limit) {
+    else if (total_domain_uses >= definition->domain_limit) {
         this->DamageBypass(50.0);
         this->SetStunState(true);
         total_domain_uses++;
-        std::println("{}You have overused your domain! You take 50 damage and are stunned for the next turn.{}", Utilities::Color::Red, Utilities::Color::Clear);
+        NARRATE(this->Out(), "{}You have overused your domain! You take 50 damage and are stunned for the next turn.{}", Utilities::Color::Red, Utilities::Color::Clear);
         return;
     }
-    domain_active = true;
+    SetFlag(DomainOn, true);
     total_domain_uses++;
-    std::println("\n********{}Domain Expansion{}********\n" "*******{}*******\n", Utilities::Color::Purple, Utilities::Color::Clear, this->GetDomain()->GetDomainName());
+    if (context) {
+        context->Index().DomainChanged(this, true);
+        context->TraitsChanged(*this);
+    }
+    RecordEvent({ .type = BattleEvent::Type::DomainActivated, .source = unique_id, .target = unique_id, .detail = total_domain_uses });
+    NARRATE(this->Out(), "\n********{}Domain Expansion{}********\n" "*******{}*******\n", Utilities::Color::Purple, Utilities::Color::Clear, this->GetDomain()->GetDomainName());
     if (technique) {
         technique->Set(Technique::Status::DomainBoost);
     }
@@ -282,7 +300,14 @@ int CurseUser::GetDomainUses() const {
 }
 
 void CurseUser::DeactivateDomain() {
-    domain_active = false;
+    if (DomainActive()) {
+        RecordEvent({ .type = BattleEvent::Type::DomainCollapsed, .source = unique_id, .target = unique_id, .detail = total_domain_uses });
+    }
+    SetFlag(DomainOn, false);
+    if (context) {
+        context->Index().DomainChanged(this, false);
+        context->TraitsChanged(*this);
+    }
     is_strained = true;
     active_domain_time = 0;
     if (technique) {
@@ -292,61 +317,56 @@ void CurseUser::DeactivateDomain() {
 }
 
 bool CurseUser::CounterDomainActive() const {
-    return counter_domain_active;
+    return flags & CounterDomainOn;
 }
 
 void CurseUser::ActivateCounterDomain() {
     if (!counter_domain) {
-        std::println("{} doesn't have a counter domain!", this->GetNameWithID());
+        NARRATE(this->Out(), "{} doesn't have a counter domain!", this->GetNameWithID());
         return;
     }
     if (counter_on_cooldown) {
-        std::println("your counter domain is on cooldown, wait for it to recover!");
+        NARRATE(this->Out(), "your counter domain is on cooldown, wait for it to recover!");
         return;
     }
-    if (!counter_domain_active) {
-        counter_domain_active = true;
-        std::println("{} activates {}!", this->GetNameWithID(), counter_domain->GetDomainName());
+    if (!CounterDomainActive()) {
+        SetFlag(CounterDomainOn, true);
+        NARRATE(this->Out(), "{} activates {}!", this->GetNameWithID(), counter_domain->GetDomainName());
     }
 }
 
 void CurseUser::DeactivateCounterDomain() {
     if (!counter_domain) {
-        std::println("{} doesn't have a counter domain!", this->GetNameWithID());
+        NARRATE(this->Out(), "{} doesn't have a counter domain!", this->GetNameWithID());
         return;
     }
-    if (counter_domain_active) {
-        counter_domain_active = false;
-        std::println("{} deactivated {}!", this->GetNameWithID(), counter_domain->GetDomainName());
+    if (CounterDomainActive()) {
+        SetFlag(CounterDomainOn, false);
+        NARRATE(this->Out(), "{} deactivated {}!", this->GetNameWithID(), counter_domain->GetDomainName());
     }
 }
 
 void CurseUser::Attack(Character* target) {
-    if (target->IsaCurseUser()) {
-        auto target_cuser = static_cast<CurseUser*>(target);
-        if (auto* tech = target_cuser->GetTechnique()) {
-            if (tech->IsLimitless() && tech->IsInfinityActive() && !domain_amplification_active) {
-                std::println("{}'s attack was blocked by {}'s {}Infinity{}!", this->GetNameWithID(), target_cuser->GetNameWithID(), Utilities::Color::Cyan, Utilities::Color::Clear);
-                return;
-            }
-        }
+    if (target->InfinityActive() && !domain_amplification_active) {
+        NARRATE(this->Out(), "{}'s attack was blocked by {}'s {}Infinity{}!", this->GetNameWithID(), target->GetNameWithID(), Utilities::Color::Cyan, Utilities::Color::Clear);
+        return;
     }
     if (domain_amplification_active) {
         double ce_addon = std::sqrt(std::max(0.0, this->GetCharacterCE())) * 0.888;
         double amp_damage = base_attack_damage + ce_addon;
 
         target->DamageBypass(amp_damage);
-        std::println("{} landed a strike on {} using {}domain amplification{}!", this->GetNameWithID(), target->GetNameWithID(), Utilities::Color::Yellow, Utilities::Color::Clear);
+        NARRATE(this->Out(), "{} landed a strike on {} using {}domain amplification{}!", this->GetNameWithID(), target->GetNameWithID(), Utilities::Color::Yellow, Utilities::Color::Clear);
         return;
     }
     else if (cursed_tool) {
-        cursed_tool->UseTool(this, target);
+        cursed_tool->DispatchUse(this, target);
         return;
     }
 
 
     bool is_black_flash = false;
-    if (Utilities::GetRandomNumber(1, 100) <= black_flash_chance) {
+    if (this->GetRandom().Next(1, 100) <= definition->black_flash_chance) {
         is_black_flash = true;
         is_strained = false;
         burnout_time = 0;
@@ -364,16 +384,17 @@ void CurseUser::Attack(Character* target) {
     target->Damage(final_damage);
 
     if (is_black_flash) {
-        std::println("\n*** {}BLACK FLASH!{} ***", Utilities::Color::Red, Utilities::Color::Clear);
-        std::println("{} landed a {}BlackFlash{} on {}!", this->GetNameWithID(), Utilities::Color::Red, Utilities::Color::Clear, target->GetNameWithID());
+        RecordEvent({ .type = BattleEvent::Type::BlackFlash, .source = unique_id, .target = target->GetID(), .detail = blackflash_chain, .amount = final_damage });
+        NARRATE(this->Out(), "\n*** {}BLACK FLASH!{} ***", Utilities::Color::Red, Utilities::Color::Clear);
+        NARRATE(this->Out(), "{} landed a {}BlackFlash{} on {}!", this->GetNameWithID(), Utilities::Color::Red, Utilities::Color::Clear, target->GetNameWithID());
     }
     else {
-        std::println("{} landed a {}heavy strike{} on {}!", this->GetNameWithID(), Utilities::Color::BrightRed, Utilities::Color::Clear, target->GetNameWithID());
+        NARRATE(this->Out(), "{} landed a {}heavy strike{} on {}!", this->GetNameWithID(), Utilities::Color::BrightRed, Utilities::Color::Clear, target->GetNameWithID());
     }
 }
 
 double CurseUser::GetBlackflashMult() const {
-    return blackflash_mult * blackflash_chain;
+    return definition->blackflash_mult * blackflash_chain;
 }
 
 void CurseUser::DomainDrain() {
@@ -387,17 +408,17 @@ bool CurseUser::DomainAmplificationActive() const {
 }
 
 double CurseUser::GetCharacterPreviousCE() const {
-    return prev_cursed_energy;
+    return Stat(HotStat::PreviousCE);
 }
 
 int CurseUser::GetBlackFlashChance()const {
-    return black_flash_chance;
+    return definition->black_flash_chance;
 }
 
 void CurseUser::RecoverBurnout() {
     if (is_strained) {
         burnout_time++;
-        if (burnout_time >= max_technique_burnout_time) {
+        if (burnout_time >= definition->max_technique_burnout_time) {
             is_strained = false;
             burnout_time = 0;
         }
@@ -408,27 +429,29 @@ void CurseUser::RecoverTechniqueBurnout(Technique* t) {
     if (t == nullptr) return;
     if (t->BurntOut()) {
         technique_burnout_time++;
-        if (technique_burnout_time >= max_technique_burnout_time) {
+        if (technique_burnout_time >= definition->max_technique_burnout_time) {
             t->Set(Technique::Status::Usable);
             technique_burnout_time = 0;
-            std::println("{}'s {}cursed technique{} has{} recovered from burnout{}!", this->GetNameWithID(), Utilities::Color::Cyan, Utilities::Color::Clear, Utilities::Color::Green, Utilities::Color::Clear);
+            NARRATE(this->Out(), "{}'s {}cursed technique{} has{} recovered from burnout{}!", this->GetNameWithID(), Utilities::Color::Cyan, Utilities::Color::Clear, Utilities::Color::Green, Utilities::Color::Clear);
         }
     }
     if (technique_burnout_time != 0 && !t->BurntOut()) technique_burnout_time = 0;
 }
 
-bool CurseUser::CanBeHit() const {
-    if (technique && technique->IsLimitless() && technique->IsInfinityActive()) {
-        return false;
-    }
-    return true;
-}
-
 void CurseUser::SetTechnique(std::unique_ptr<Technique> t) { 
     technique = std::move(t); 
+    SyncTechniqueFlags();
 }
 void CurseUser::SetDomain(std::unique_ptr<Domain> d) { 
     domain = std::move(d); 
+    SetFlag(HasIdleDeathGamble, domain && domain->IsIdleDeathGamble());
+}
+
+void CurseUser::SyncTechniqueFlags() {
+    SetFlag(HasLimitless, technique && technique->IsLimitless());
+    SetFlag(HasShrine, technique && technique->IsShrine());
+    SetFlag(InfinityOn, technique && technique->IsInfinityActive());
+    if (context) context->TraitsChanged(*this);
 }
 void CurseUser::SetSpecial(std::unique_ptr<Specials> s) { 
     special = std::move(s); 
@@ -439,21 +462,27 @@ void CurseUser::AddShikigami(std::unique_ptr<Shikigami> s) {
 void CurseUser::SetCounterDomain(std::unique_ptr<Domain> cd) { 
     counter_domain = std::move(cd); 
 }
+void CurseUser::CloneLoadoutFrom(const CurseUser& entry) {
+    if (entry.technique) SetTechnique(entry.technique->Clone());
+    if (entry.domain) SetDomain(entry.domain->Clone());
+    if (entry.counter_domain) SetCounterDomain(entry.counter_domain->Clone());
+    if (entry.special) SetSpecial(entry.special->Clone());
+}
 void CurseUser::SetBlackflashChance(int d) { 
-    black_flash_chance = d; 
+    EditDefinition().black_flash_chance = d; 
 }
 void CurseUser::SetDomainLimit(int d) { 
-    domain_limit = d; 
+    EditDefinition().domain_limit = d; 
 }
 void CurseUser::SetMaxZoneTime(int t){
-    max_zone_time = t;
+    EditDefinition().max_zone_time = t;
 }
 void CurseUser::SetMaxDomainTime(int t){
-    max_domain_time = t;
+    EditDefinition().max_domain_time = t;
 }
 void CurseUser::SetBlackFlashMult(double m){
-    blackflash_mult = m;
+    EditDefinition().blackflash_mult = m;
 }
 void CurseUser::SetMaxBurnoutTime(int t){
-    max_technique_burnout_time = t;
+    EditDefinition().max_technique_burnout_time = t;
 }
\ No newline at end of file
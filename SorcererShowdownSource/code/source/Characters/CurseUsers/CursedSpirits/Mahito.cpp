@@ -6,24 +6,28 @@
 
 
 
-Mahito::Mahito() : CursedSpirit(650.0, 5500.0, 40.0) {
-	technique = std::make_unique<IdleTransfiguration>();
-	domain = std::make_unique<SelfEmbodimentOfPerfection>();
-	passive_health_regen = 35.0;
-	black_flash_chance = 20;
+Mahito::Mahito() : Mahito(BareLoadout{}) {
+	SetTechnique(std::make_unique<IdleTransfiguration>());
+	SetDomain(std::make_unique<SelfEmbodimentOfPerfection>());
+}
+
+Mahito::Mahito(BareLoadout) : CursedSpirit(650.0, 5500.0, 40.0) {
+	Stat(HotStat::PassiveRegen) = 35.0;
 	base_attack_damage = 50.0;
 
-	char_name = "Mahito";
-	name_color = "\033[35m";
+	static const auto mahito_definition = CharacterDefinition::Make({ .name = "Mahito", .color = "\033[35m", .black_flash_chance = 20 });
+	definition = mahito_definition;
 }
 
 std::unique_ptr<Character> Mahito::Clone() const {
-	return std::make_unique<Mahito>();
+	std::unique_ptr<Mahito> mahito(new Mahito(BareLoadout{}));
+	mahito->CloneLoadoutFrom(*this);
+	return mahito;
 }
 
 void Mahito::OnCharacterTurn(Battlefield& bf){
 	if (this->IsCharacterStunned()) {
-		std::println("{} is stunned and their turn will be skipped", this->GetNameWithID());
+		NARRATE(this->Out(), "{} is stunned and their turn will be skipped", this->GetNameWithID());
 		return;
 	}
 	IdleTransfiguration* tf = static_cast<IdleTransfiguration*>(this->GetTechnique());
@@ -50,17 +54,13 @@ void Mahito::OnCharacterTurn(Battlefield& bf){
 	else summon_humans = false;  
 
 	if (summon_humans && tf->GetTFcount() > 0) {
-		int summon_amount = 0;
-		std::println("{} is releasing a swarm of transfigured humans!", this->GetNameWithID());
-		while (tf->GetTFcount() > 0) {
-			tf->SummonTransfiguredHumans(bf);
-			summon_amount++;
-		}
+		NARRATE(this->Out(), "{} is releasing a swarm of transfigured humans!", this->GetNameWithID());
+		int summon_amount = tf->SummonTransfiguredHumans(bf, tf->GetTFcount());
 		if (summon_amount > 1) {
-			std::println("{} has summoned a total of {} transfigured humans!", this->GetNameWithID(), summon_amount);
+			NARRATE(this->Out(), "{} has summoned a total of {} transfigured humans!", this->GetNameWithID(), summon_amount);
 		}
 		else {
-			std::println("{} has summoned a transfigured human!", this->GetNameWithID());
+			NARRATE(this->Out(), "{} has summoned a transfigured human!", this->GetNameWithID());
 		}
 		return;
 	}
@@ -5,24 +5,26 @@
 
 
 
-TransfiguredHuman::TransfiguredHuman() : CursedSpirit(50.0, 10.0, 0.0) {
-	passive_health_regen = 0.0;
-	current_ce_reinforcement = 0.0;
-	max_ce_reinforcement = 0.0;
-	base_attack_damage = static_cast<double>(Utilities::GetRandomNumber(5, 20));
-	black_flash_chance = 0;
-	char_name = "Transfigured Human";
+TransfiguredHuman::TransfiguredHuman(BattleRandom& battle_rng) : CursedSpirit(50.0, 10.0, 0.0) {
+	Stat(HotStat::PassiveRegen) = 0.0;
+	Stat(HotStat::Reinforcement) = 0.0;
+	Stat(HotStat::MaxReinforcement) = 0.0;
+	base_attack_damage = static_cast<double>(battle_rng.Next(5, 20));
+	static const auto transfigured_definition = CharacterDefinition::Make({ .name = "Transfigured Human", .black_flash_chance = 0 });
+	definition = transfigured_definition;
 };
 
 void TransfiguredHuman::OnCharacterTurn(Battlefield& bf) {
 	if (this->IsCharacterStunned()) {
-		std::println("{} is stunned and their turn will be skipped", this->GetNameWithID());
+		NARRATE(this->Out(), "{} is stunned and their turn will be skipped", this->GetNameWithID());
 		return;
 	}
 	Character* target = nullptr;
 
+	auto coin = this->GetRandom().Batch(bf.battlefield.size(), 0, 1, &bf.context.Scratch());
+	size_t slot = 0;
 	for (const auto& tar : bf.battlefield) {
-
+		const int coin_flip = coin[slot++];
 		if (tar.get() != this)
 		{
 			if (!target) {
@@ -32,13 +34,13 @@ void TransfiguredHuman::OnCharacterTurn(Battlefield& bf) {
 			if (tar->IsaCursedSpirit()) {
 				continue;
 			}
-			if (Utilities::GetRandomNumber(0, 1) == 1) {
+			if (coin_flip == 1) {
 				target = tar.get();
 			}
 		}
 	}
 	if (!target) {
-		std::println("The transfigured human just stands menacingly");
+		NARRATE(this->Out(), "The transfigured human just stands menacingly");
 		return;
 	}
 	this->Attack(target);
@@ -7,32 +7,38 @@
 #include "code/header/GameManagement/Utils.h"
 #include "code/header/Characters/PhysicallyGifted/PhysicallyGifted.h"
 
+namespace {
+    const ThreatPolicy gojo_policy = { .health = ThreatPolicy::Health::AgainstSelf, .domain = 0.50, .shrine = 1.0, .limitless = 0.15, .infinity = 0.30, .check_infinity = true, .gifted = 0.25 };
+}
+
 
 
-Gojo::Gojo() : Sorcerer(800.0, 12500.0, 150.0) {
-    domain = std::make_unique<InfiniteVoid>();
+Gojo::Gojo() : Gojo(BareLoadout{}) {
+    SetDomain(std::make_unique<InfiniteVoid>());
     counter_domain = std::make_unique<SimpleDomain>();
-    technique = std::make_unique<Limitless>();
+    SetTechnique(std::make_unique<Limitless>());
     special = std::make_unique<UnlimitedPurple>();
-    six_eyes = true;
-    black_flash_chance = 15;
+}
+Gojo::Gojo(BareLoadout) : Sorcerer(800.0, 12500.0, 150.0) {
     base_attack_damage = 100.0;
     rct_skill = RCTProficiency::Absolute;
-    char_name = "Gojo";
-    name_color = "\033[96m";
+    static const auto gojo_definition = CharacterDefinition::Make({ .name = "Gojo", .color = "\033[96m", .black_flash_chance = 15, .six_eyes = true });
+    definition = gojo_definition;
 }
 std::unique_ptr<Character> Gojo::Clone() const {
-    return std::make_unique<Gojo>();
+    std::unique_ptr<Gojo> gojo(new Gojo(BareLoadout{}));
+    gojo->CloneLoadoutFrom(*this);
+    return gojo;
 }
 
 void Gojo::OnCharacterTurn(Battlefield& bf) {
     if (this->IsCharacterStunned()) {
-        std::println("{} is stunned and their turn will be skipped", this->GetNameWithID());
+        NARRATE(this->Out(), "{} is stunned and their turn will be skipped", this->GetNameWithID());
         return;
     }
     auto* limitless = static_cast<Limitless*>(this->GetTechnique());
     if (!limitless->CheckInfinity() && this->CEMoreThanMax(0.03) && !limitless->BurntOut()) {
-        limitless->SetInfinity(true);
+        limitless->SetInfinity(this, true);
     }
     if ((!this->HPMoreThanMax(0.35) && this->CEMoreThanMax(0.25)) || !limitless->CheckInfinity()) 
     {
@@ -60,43 +66,8 @@ void Gojo::OnCharacterTurn(Battlefield& bf) {
         this->SetCurrentReinforcement(0.0);
     }
 
-    double best_score = -1.0;
-    Character* strongest = nullptr;
-    std::vector<CurseUser*> domain_users;
-
-    for (const auto& target : bf.battlefield) {
-        if (target.get() == this) continue;
-
-        double hp_ratio = target->GetCharacterHealth() / this->GetCharacterMaxHealth();
-        double score = hp_ratio;
-
-        if (target->IsaCurseUser()) {
-            auto curse_user = static_cast<CurseUser*>(target.get());
-            if (curse_user->DomainActive()) {
-                domain_users.push_back(curse_user);
-                score += 0.50;
-            }
-            if (auto* tech = curse_user->GetTechnique()) {
-                if (tech->IsShrine()) {
-                    score += 1.0;
-                }
-                if (tech->IsLimitless()) {
-                    score += (tech->IsInfinityActive() ? 0.30 : 0.15);
-                }
-            }
-        }
-        else if (target->IsPhysicallyGifted()) {
-            score += 0.25;
-        }
-        score += Utilities::GetRandomNumber(-5, 5) * 0.01;
-
-        if (score > best_score) {
-            best_score = score;
-            strongest = target.get();
-        }
-
-    }
-    int tntroll = Utilities::GetRandomNumber(1, 100);
+    Character* strongest = bf.context.Threats().Pick(this, gojo_policy);
+    int tntroll = this->GetRandom().Next(1, 100);
 
     if (tntroll <= 45) {
         this->Taunt(strongest);
@@ -109,13 +80,14 @@ void Gojo::OnCharacterTurn(Battlefield& bf) {
         }
     }
     
-    if (!domain_users.empty()) {
+    const int other_domains = bf.context.Index().OtherActiveDomains(this);
+    if (other_domains > 0) {
         if (!limitless->BurntOut() && this->GetDomainUses() < 6 && !this->DomainActive()) {
-            if (domain_users.size() == 1) {
+            if (other_domains == 1) {
                 this->ActivateDomain(); 
                 return;
             }
-            else if (Utilities::GetRandomNumber(1, 100) <= 1) {
+            else if (this->GetRandom().Next(1, 100) <= 1) {
                 this->ActivateDomain();
                 return;
             }
@@ -131,7 +103,7 @@ void Gojo::OnCharacterTurn(Battlefield& bf) {
             return;
         }
         if (!limitless->BurntOut() && this->GetDomainUses() < 5 && !this->DomainActive()) {
-            if (Utilities::GetRandomNumber(1, 100) <= 30) {
+            if (this->GetRandom().Next(1, 100) <= 30) {
                 this->ActivateDomain();
                 return;
             }
@@ -147,13 +119,13 @@ void Gojo::OnCharacterTurn(Battlefield& bf) {
     }
 
     if (strongest && !limitless->BurntOut() && this->CEMoreThanMax(0.03) && !this->DomainAmplificationActive()) {
-        int roll = Utilities::GetRandomNumber(1, 100);
-        int croll = Utilities::GetRandomNumber(1, 10);
+        int roll = this->GetRandom().Next(1, 100);
+        int croll = this->GetRandom().Next(1, 10);
 
         if ((croll <= 4 && !limitless->FullyChanted()) || 
             (limitless->UnlimitedHollowAllowed() && !limitless->FullyChanted() && !limitless->UnlimitedHollowUsed())) 
         {
-            limitless->Chant();
+            limitless->Chant(this);
             return;
         }
         if (limitless->FullyChanted() && limitless->UnlimitedHollowAllowed() && !limitless->UnlimitedHollowUsed()) {
@@ -176,14 +148,5 @@ void Gojo::OnCharacterTurn(Battlefield& bf) {
 }
 
 bool Gojo::InfCheck(Character* strongest) {
-    bool needs_amplification = false;
-    if (strongest->IsaCurseUser()) {
-        auto curse_user = static_cast<CurseUser*>(strongest);
-        if (auto* tech = curse_user->GetTechnique()) {
-            if (tech->IsLimitless() && tech->IsInfinityActive()) {
-                needs_amplification = true;
-            }
-        }
-    }
-    return needs_amplification;
+    return strongest->InfinityActive();
 }
\ No newline at end of file
@@ -6,28 +6,35 @@
 #include "code/header/Characters/CurseUsers/CursedSpirits/CursedSpirit.h"
 #include "code/header/GameManagement/Utils.h"
 
+namespace {
+    const ThreatPolicy hakari_policy = { .health = ThreatPolicy::Health::AgainstSelf, .domain = 0.50, .gifted = 0.25, .spirit = 0.35 };
+}
+
 
 
 
-Hakari::Hakari():Sorcerer(650.0, 5500.0, 75.0) {
-    black_flash_chance = 15;
-    domain = std::make_unique<IdleDeathGamble>();
-    technique = std::make_unique<PrivatePureLoveTrain>();
+Hakari::Hakari() : Hakari(BareLoadout{}) {
+    SetDomain(std::make_unique<IdleDeathGamble>());
+    SetTechnique(std::make_unique<PrivatePureLoveTrain>());
+}
+
+Hakari::Hakari(BareLoadout) : Sorcerer(650.0, 5500.0, 75.0) {
     rct_skill = RCTProficiency::Absolute;
-    domain_limit = 999;
     base_attack_damage = 60.0;
 
-    char_name = "Hakari";
-    name_color = "\033[38;5;157m";
+    static const auto hakari_definition = CharacterDefinition::Make({ .name = "Hakari", .color = "\033[38;5;157m", .black_flash_chance = 15, .domain_limit = 999 });
+    definition = hakari_definition;
 }
 
 std::unique_ptr<Character> Hakari::Clone() const {
-    return std::make_unique<Hakari>();
+    std::unique_ptr<Hakari> hakari(new Hakari(BareLoadout{}));
+    hakari->CloneLoadoutFrom(*this);
+    return hakari;
 }
 
 void Hakari::OnCharacterTurn(Battlefield& bf) {
     if (this->IsCharacterStunned()) {
-        std::println("{} is stunned! He's forced to skip his turn.", this->GetName());
+        NARRATE(this->Out(), "{} is stunned! He's forced to skip his turn.", this->GetName());
         return;
     }
     auto pplt = static_cast<PrivatePureLoveTrain*>(this->GetTechnique());
@@ -46,35 +53,7 @@ void Hakari::OnCharacterTurn(Battlefield& bf) {
         this->SetCurrentReinforcement(0.0);
     }
 
-    double best_score = -1.0;
-    Character* strongest = nullptr;
-    std::vector<CurseUser*> domain_users;
-
-    for (const auto& s : bf.battlefield) {
-        if (s.get() == this) continue;
-        double score = s->GetCharacterHealth() / this->GetCharacterMaxHealth();
-
-        if (s->IsaCurseUser()) {
-            auto curse_user = static_cast<CurseUser*>(s.get());
-            if (curse_user->DomainActive()) {
-                domain_users.push_back(curse_user);
-                score += 0.50;
-            }
-        }
-        else if (s->IsPhysicallyGifted()) {
-            score += 0.25;
-        }
-        else if (s->IsaCursedSpirit()) {
-            score += 0.35;
-        }
-
-        score += Utilities::GetRandomNumber(-5, 5) * 0.01;
-
-        if (score > best_score) {
-            best_score = score;
-            strongest = s.get();
-        }
-    }
+    Character* strongest = bf.context.Threats().Pick(this, hakari_policy);
 
     if (!strongest) return;
 
@@ -91,7 +70,7 @@ void Hakari::OnCharacterTurn(Battlefield& bf) {
     }
 
     if (!pplt->BurntOut()) {
-        int roll = Utilities::GetRandomNumber(1, 100);
+        int roll = this->GetRandom().Next(1, 100);
         if (roll <= 60) {
             pplt->UseShutterDoors(this, strongest);
         }
@@ -112,7 +91,7 @@ void Hakari::TickCharacterSpecialty() {
     auto pplt = static_cast<PrivatePureLoveTrain*>(this->GetTechnique());
 
     if (idg->HasHitJackpot()) {
-        this->SetCursedEnergyRegen(std::min(ce_regen * 50.0, 5500.0));
+        this->SetCursedEnergyRegen(std::min(Stat(HotStat::CERegen) * 50.0, 5500.0));
         this->BoostRCT();
         jackpot_tick++;
         if (jackpot_tick > 5) {
@@ -123,7 +102,7 @@ void Hakari::TickCharacterSpecialty() {
             is_strained = false;
             this->SetCursedEnergyRegen(saved_ce_regen);
             this->DisableRCT();
-            std::println("{}'s Jackpot has worn off!", this->GetNameWithID());
+            NARRATE(this->Out(), "{}'s Jackpot has worn off!", this->GetNameWithID());
         }
     }
     if (pplt->PlinkoUsed()) {
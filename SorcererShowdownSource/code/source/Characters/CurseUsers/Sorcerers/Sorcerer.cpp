@@ -9,34 +9,30 @@
 
 
 
-Sorcerer::Sorcerer(double hp, double ce, double re) : CurseUser(hp, ce, re) {}
+Sorcerer::Sorcerer(double hp, double ce, double re) : CurseUser(hp, ce, re) {
+    flags |= KindSorcerer;
+    hit_blockers = 0; // infinity stops sorcerers' attackers in Attack, not here
+}
 Sorcerer::~Sorcerer() = default;
 
 void Sorcerer::SetSixEyes(bool t) {
-    six_eyes = t;
+    EditDefinition().six_eyes = t;
 }
 
 bool Sorcerer::HasSixEyes() const {
-    return six_eyes;
+    return definition->six_eyes;
 }
 
 std::unique_ptr<Character> Sorcerer::Clone() const {
-    auto s = std::make_unique<Sorcerer>(max_health, max_cursed_energy, ce_regen);
+    auto s = std::make_unique<Sorcerer>(Stat(HotStat::MaxHealth), Stat(HotStat::MaxCursedEnergy), Stat(HotStat::CERegen));
     if (this->technique) s->SetTechnique(this->technique->Clone());
     if (this->domain)    s->SetDomain(this->domain->Clone());
     if (this->special)   s->SetSpecial(this->special->Clone());
     if (this->cursed_tool) s->SetEquippedTool(this->cursed_tool->Clone());
     if (this->brain) s->SetBrain(this->brain->Clone());
-    s->SetCharacterName(this->char_name, this->name_color);
-    s->SetSixEyes(this->six_eyes);
+    s->ShareDefinition(*this);
     s->SetBaseDamage(this->base_attack_damage); 
-    s->SetBlackflashChance(this->black_flash_chance);
-    s->SetDomainLimit(this->domain_limit);
-    s->SetMaxReinforcement(this->max_ce_reinforcement);
-    s->SetMaxZoneTime(this->max_zone_time);
-    s->SetMaxDomainTime(this->max_domain_time);
-    s->SetBlackFlashMult(this->blackflash_mult);
-    s->SetMaxBurnoutTime(this->max_technique_burnout_time);
+    s->SetMaxReinforcement(Stat(HotStat::MaxReinforcement));
     for (const auto& tool : this->inventory_curse) {
         if (tool) s->AddToolToInventory(tool->Clone());
     }
@@ -51,7 +47,10 @@ void Sorcerer::SpendCE(double ce) {
             efficiency = 0.85; 
         }
     }
+    double& cursed_energy = Stat(HotStat::CursedEnergy);
+    double before = cursed_energy;
     cursed_energy = std::max(cursed_energy - (ce * efficiency), 0.0);
+    RecordCESpent(before);
 }
 
 void Sorcerer::DisableRCT() {
@@ -136,10 +135,3 @@ void Sorcerer::SetRCTProficiency(std::string str) {
     }
 }
 
-bool Sorcerer::CanBeHit() const {
-    return true;
-}
-
-bool Sorcerer::IsaSorcerer()const {
-    return true;
-}
\ No newline at end of file
@@ -9,29 +9,37 @@
 #include "code/header/GameManagement/Utils.h"
 #include "code/header/Characters/PhysicallyGifted/PhysicallyGifted.h"
 
+namespace {
+    const ThreatPolicy sukuna_policy = { .health = ThreatPolicy::Health::AgainstSelf, .domain = 0.50, .shrine = 1.0, .limitless = 0.15, .infinity = 0.30, .check_infinity = true, .gifted = 0.25, .skip_dead = true };
+}
+
 
-Sukuna::Sukuna() : Sorcerer(1000.0, 20000.0, 300.0) {
-    domain = std::make_unique<MalevolentShrine>();
+Sukuna::Sukuna() : Sukuna(BareLoadout{}) {
+    SetDomain(std::make_unique<MalevolentShrine>());
     counter_domain = std::make_unique<HollowWickerBasket>();
-    technique = std::make_unique<Shrine>();
+    SetTechnique(std::make_unique<Shrine>());
+    special = std::make_unique<WorldCuttingSlash>();
+}
+
+Sukuna::Sukuna(BareLoadout) : Sorcerer(1000.0, 20000.0, 300.0) {
     shikigami.push_back(std::make_unique<Mahoraga>());
     shikigami.push_back(std::make_unique<Agito>());
-    special = std::make_unique<WorldCuttingSlash>();
-    black_flash_chance = 10;
     base_attack_damage = 90.0;
     rct_skill = RCTProficiency::Absolute;
 
-    char_name = "Sukuna";
-    name_color = "\033[31m";
+    static const auto sukuna_definition = CharacterDefinition::Make({ .name = "Sukuna", .color = "\033[31m", .black_flash_chance = 10 });
+    definition = sukuna_definition;
 }
 
 std::unique_ptr<Character> Sukuna::Clone() const {
-    return std::make_unique<Sukuna>();
+    std::unique_ptr<Sukuna> sukuna(new Sukuna(BareLoadout{}));
+    sukuna->CloneLoadoutFrom(*this);
+    return sukuna;
 }
 
 void Sukuna::OnCharacterTurn(Battlefield& bf) {
     if (this->IsCharacterStunned()) {
-        std::println("{} is stunned and their turn will be skipped", this->GetNameWithID());
+        NARRATE(this->Out(), "{} is stunned and their turn will be skipped", this->GetNameWithID());
         return;
     }
     if (!this->HPMoreThanMax(0.25) && this->CEMoreThanMax(0.15))
@@ -60,46 +68,10 @@ void Sukuna::OnCharacterTurn(Battlefield& bf) {
         this->SetCurrentReinforcement(0.0);
     }
 
-    double best_score = -1.0;
-    Character* strongest = nullptr;
-    std::vector<CurseUser*> domain_users;
-
-    for (const auto& target : bf.battlefield) {
-        if (target.get() == this || target->GetCharacterHealth() <= 0.0) continue;
-
-        double hp_ratio = target->GetCharacterHealth() / this->GetCharacterMaxHealth();
-        double score = hp_ratio;
-
-        if (target->IsaCurseUser()) {
-            auto curse_user = static_cast<CurseUser*>(target.get());
-
-            if (curse_user->DomainActive()) {
-                domain_users.push_back(curse_user);
-                score += 0.50;
-            }
-            if (auto* tech = curse_user->GetTechnique()) {
-                if (tech->IsShrine()) {
-                    score += 1.0;
-                }
-                if (tech->IsLimitless()) {
-                    score += (tech->IsInfinityActive() ? 0.30 : 0.15);
-                }
-            }
-        }
-        else if (target->IsPhysicallyGifted()) {
-            score += 0.25;
-        }
-
-        score += Utilities::GetRandomNumber(-5, 5) * 0.01;
-
-        if (score > best_score) {
-            best_score = score;
-            strongest = target.get();
-        }
-    }
+    Character* strongest = bf.context.Threats().Pick(this, sukuna_policy);
     if (!strongest) return;
     
-    if (Utilities::GetRandomNumber(1, 20) <= 11) {
+    if (this->GetRandom().Next(1, 20) <= 11) {
         this->Taunt(strongest);
     }
 
@@ -146,12 +118,12 @@ void Sukuna::OnCharacterTurn(Battlefield& bf) {
         }
     }
 
-    if (shrine->WorldCuttingSlashUnlocked() && this->CEMoreThanMax(0.125) && Utilities::GetRandomNumber(1, 100) >= 65) {
+    if (shrine->WorldCuttingSlashUnlocked() && this->CEMoreThanMax(0.125) && this->GetRandom().Next(1, 100) >= 65) {
         if (makora && makora->IsActive()) {
             makora->Withdraw();
         }
         if (!shrine->FullyChanted()) {
-            shrine->Chant();
+            shrine->Chant(this);
             return;
         }
         if (shrine->FullyChanted() && this->CEMoreThanMax(0.125)) {
@@ -159,13 +131,14 @@ void Sukuna::OnCharacterTurn(Battlefield& bf) {
             return;
         }
     }
-    if (!domain_users.empty()) {
+    const int other_domains = bf.context.Index().OtherActiveDomains(this);
+    if (other_domains > 0) {
         if (!shrine->BurntOut() && this->GetDomainUses() < 5 && !this->DomainActive()) {
-            if (domain_users.size() == 1) {
+            if (other_domains == 1) {
                 this->ActivateDomain();
                 return;
             }
-            else if (Utilities::GetRandomNumber(1, 100) <= 1) {
+            else if (this->GetRandom().Next(1, 100) <= 1) {
                 this->ActivateDomain();
                 return;
             }
@@ -181,21 +154,14 @@ void Sukuna::OnCharacterTurn(Battlefield& bf) {
             return;
         }
         if (!shrine->BurntOut() && this->GetDomainUses() < 5 && !this->DomainActive()) {
-            if (Utilities::GetRandomNumber(1, 100) <= 20) {
+            if (this->GetRandom().Next(1, 100) <= 20) {
                 this->ActivateDomain();
                 return;
             }
         }
     }
 
-    bool needs_da = false;
-    if (strongest->IsaCurseUser()) {
-        auto* cu = static_cast<CurseUser*>(strongest);
-        if (auto* ct = cu->GetTechnique()) {
-            if (ct->IsLimitless() && ct->IsInfinityActive()) needs_da = true;
-        }
-    }
-
+    bool needs_da = strongest->InfinityActive();
     if (needs_da) {
         this->SetAmplification(true);
     }
@@ -204,12 +170,12 @@ void Sukuna::OnCharacterTurn(Battlefield& bf) {
     } 
 
     if (!needs_da && !shrine->BurntOut()) {
-        if (Utilities::GetRandomNumber(1, 100) <= 25 && !shrine->FullyChanted()) {
-            shrine->Chant();
+        if (this->GetRandom().Next(1, 100) <= 25 && !shrine->FullyChanted()) {
+            shrine->Chant(this);
             return;
         }
         if (this->CEMoreThanMax(0.050)) {
-            if (strongest->GetCharacterHealth() < strongest->GetCharacterMaxHealth() * 0.25 && Utilities::GetRandomNumber(1, 100) <= 15) {
+            if (strongest->GetCharacterHealth() < strongest->GetCharacterMaxHealth() * 0.25 && this->GetRandom().Next(1, 100) <= 15) {
                 shrine->UseCleave(this, strongest);
                 return;
             }
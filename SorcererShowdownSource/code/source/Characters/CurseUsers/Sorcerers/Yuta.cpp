@@ -9,34 +9,42 @@
 #include "code/header/GameManagement/Utils.h"
 #include "code/header/Characters/PhysicallyGifted/PhysicallyGifted.h"
 
-Yuta::Yuta() : Sorcerer(800.0, 15000.0, 10.0) {
-    technique = std::make_unique<Copy>();
-    cursed_tool = std::make_unique<Katana>();
-    domain = std::make_unique<AuthenticMutualLove>();
+namespace {
+    const ThreatPolicy yuta_policy = { .health = ThreatPolicy::Health::AgainstSelf, .domain = 0.50, .shrine = 0.80, .limitless = 0.15, .gifted = 0.25, .skip_dead = true };
+}
+
+Yuta::Yuta() : Yuta(BareLoadout{}) {
+    SetTechnique(std::make_unique<Copy>());
+    SetDomain(std::make_unique<AuthenticMutualLove>());
     counter_domain = std::make_unique<SimpleDomain>();
+}
+
+Yuta::Yuta(BareLoadout) : Sorcerer(800.0, 15000.0, 10.0) {
+    cursed_tool = std::make_unique<Katana>();
     shikigami.push_back(std::make_unique<Rika>());
-    black_flash_chance = 10;
     base_attack_damage = 70.0;
     rct_skill = RCTProficiency::Adept;
 
-    char_name = "Yuta Okkotsu";
-    name_color = "\033[38;5;183m";
+    static const auto yuta_definition = CharacterDefinition::Make({ .name = "Yuta Okkotsu", .color = "\033[38;5;183m", .black_flash_chance = 10 });
+    definition = yuta_definition;
 }
 
 std::unique_ptr<Character> Yuta::Clone() const {
-    return std::make_unique<Yuta>();
+    std::unique_ptr<Yuta> yuta(new Yuta(BareLoadout{}));
+    yuta->CloneLoadoutFrom(*this);
+    return yuta;
 }
 
 void Yuta::OnCharacterTurn(Battlefield& bf) {
     if (this->IsCharacterStunned()) {
-        std::println("{} is stunned and their turn will be skipped", this->GetNameWithID());
+        NARRATE(this->Out(), "{} is stunned and their turn will be skipped", this->GetNameWithID());
         return;
     }
     Shikigami* rika = this->ChooseShikigami(0);
 
     if (!this->HPMoreThanMax(0.50) || !this->CEMoreThanMax(0.20)) {
         if (!(rika->GetActiveTime() >= 5) && !rika->IsActivePhysically()) {
-            std::println("Come, Rika.");
+            NARRATE(this->Out(), "Come, Rika.");
             rika->Manifest();
         }
     }
@@ -61,46 +69,17 @@ void Yuta::OnCharacterTurn(Battlefield& bf) {
         this->SetCurrentReinforcement(50.0);
     }
 
-    double best_score = -1.0;
-    Character* strongest = nullptr;
-    std::vector<CurseUser*> domain_users;
-
-    for (const auto& s : bf.battlefield) {
-        if (s.get() == this || s->GetCharacterHealth() <= 0) continue;
-        double score = s->GetCharacterHealth() / this->GetCharacterMaxHealth();
-
-        if (s->IsaCurseUser()) {
-            auto curse_user = static_cast<CurseUser*>(s.get());
-            if (curse_user->DomainActive()) {
-                domain_users.push_back(curse_user);
-                score += 0.50;
-            }
-
-            if (auto* tech = curse_user->GetTechnique()) {
-                if (tech->IsShrine()) score += 0.80;
-                if (tech->IsLimitless()) score += 0.15;
-            }
-        }
-        else if (s->IsPhysicallyGifted()) {
-            score += 0.25;
-        }
-
-        score += Utilities::GetRandomNumber(-5, 5) * 0.01;
-
-        if (score > best_score) {
-            best_score = score;
-            strongest = s.get();
-        }
-    }
+    Character* strongest = bf.context.Threats().Pick(this, yuta_policy);
 
-    int tntroll = Utilities::GetRandomNumber(1, 20);
+    int tntroll = this->GetRandom().Next(1, 20);
     if (tntroll <= 4) {
         this->Taunt(strongest);
     }
 
-    if (!domain_users.empty()) {
+    const int other_domains = bf.context.Index().OtherActiveDomains(this);
+    if (other_domains > 0) {
         if (!this->GetTechnique()->BurntOut() && this->GetDomainUses() < 5 && !this->DomainActive()) {
-            if (domain_users.size() == 1) {
+            if (other_domains == 1) {
                 this->ActivateDomain();
                 return;
             }
@@ -116,7 +95,7 @@ void Yuta::OnCharacterTurn(Battlefield& bf) {
             return;
         }
         if (!this->GetTechnique()->BurntOut() && this->GetDomainUses() < 5 && !this->DomainActive()) {
-            if (Utilities::GetRandomNumber(1, 100) <= 25) {
+            if (this->GetRandom().Next(1, 100) <= 25) {
                 this->ActivateDomain();
                 return;
             }
@@ -131,7 +110,7 @@ void Yuta::OnCharacterTurn(Battlefield& bf) {
     }
 
     if (strongest && !this->GetTechnique()->BurntOut() && !this->DomainAmplificationActive()) {
-        if (this->GetTechnique()->AutoTechniqueUse(this, strongest, bf)) {
+        if (this->GetTechnique()->DispatchAutoUse(this, strongest, bf)) {
             return;
         }
     }
@@ -139,15 +118,5 @@ void Yuta::OnCharacterTurn(Battlefield& bf) {
 }
 
 bool Yuta::InfCheck(Character* strongest) {
-    bool needs_amplification = false;
-    if (!strongest) return false;
-    if (strongest->IsaCurseUser()) {
-        auto crs = static_cast<CurseUser*>(strongest);
-        if (auto* tech = crs->GetTechnique()) {
-            if (tech->IsLimitless() && tech->IsInfinityActive()) {
-                needs_amplification = true;
-            }
-        }
-    }
-    return needs_amplification;
+    return strongest && strongest->InfinityActive();
 }
@@ -9,13 +9,16 @@
 PhysicallyGifted::PhysicallyGifted(double hp, double str) : 
     Character(hp), 
     strength(str) {
+    Stat(HotStat::PassiveRegen) = GetHealingFactor();
+    Stat(HotStat::Regenerates) = 1.0;
+    flags |= KindGifted;
 }
 
 std::unique_ptr<Character> PhysicallyGifted::Clone() const {
-    auto pg = std::make_unique<PhysicallyGifted>(max_health, strength);
+    auto pg = std::make_unique<PhysicallyGifted>(Stat(HotStat::MaxHealth), strength);
     if (this->brain) pg->SetBrain(this->brain->Clone());
     if (this->cursed_tool) pg->SetEquippedTool(this->cursed_tool->Clone());
-    pg->SetCharacterName(this->char_name, this->name_color);
+    pg->ShareDefinition(*this);
     pg->SetStrength(this->strength);
     pg->SetBaseDamage(this->base_attack_damage);    
     for (const auto& tool : this->inventory_curse) {
@@ -29,31 +32,24 @@ double PhysicallyGifted::GetHealingFactor() const {
 }
 
 void  PhysicallyGifted::Attack(Character* target) {
-    if (target->IsaCurseUser()) {
-        auto* target_cuser = static_cast<CurseUser*>(target);
-        if (auto* tech = target_cuser->GetTechnique()) {
-            bool has_spear = cursed_tool && cursed_tool->IsAntiTechniqueWeapon();
-            if ((tech->IsLimitless() && tech->IsInfinityActive()) && !has_spear) {
-                std::println("{}'s attack was blocked by {}'s {}Infinity{}!",
-                    this->GetNameWithID(), target_cuser->GetNameWithID(), Utilities::Color::Cyan, Utilities::Color::Clear);
-                return;
-            }
+    if (target->InfinityActive()) {
+        bool has_spear = cursed_tool && cursed_tool->IsAntiTechniqueWeapon();
+        if (!has_spear) {
+            NARRATE(this->Out(), "{}'s attack was blocked by {}'s {}Infinity{}!",
+                this->GetNameWithID(), target->GetNameWithID(), Utilities::Color::Cyan, Utilities::Color::Clear);
+            return;
         }
     }
 
     if (cursed_tool) {
-        cursed_tool->UseTool(this, target);
+        cursed_tool->DispatchUse(this, target);
     }
     else {
-        std::println("{} strikes {} with their bare hands!", this->GetNameWithID(), target->GetNameWithID());
+        NARRATE(this->Out(), "{} strikes {} with their bare hands!", this->GetNameWithID(), target->GetNameWithID());
         target->Damage(10.0 * this->GetStrengthDamage());
     }
 }
 
-bool PhysicallyGifted::IsPhysicallyGifted() const {
-	return true;
-}
-
 double PhysicallyGifted::GetStrength() const {
 	return strength;
 }
@@ -67,8 +63,5 @@ double PhysicallyGifted::GetDamageReinforcement() const {
 
 void PhysicallyGifted::SetStrength(double str) {
     strength = str;
-}
-
-void PhysicallyGifted::TickCharacterSpecialty() {
-    this->Regen(this->GetHealingFactor());
+    Stat(HotStat::PassiveRegen) = GetHealingFactor();
 }
\ No newline at end of file
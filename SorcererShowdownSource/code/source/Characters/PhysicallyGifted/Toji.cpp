@@ -5,6 +5,10 @@
 #include "code/header/Characters/CurseUsers/Sorcerers/Sorcerer.h"
 #include "code/header/GameManagement/Utils.h"
 
+namespace {
+    const ThreatPolicy toji_policy = { .health = ThreatPolicy::Health::Missing, .limitless = 0.15, .skip_dead = true };
+}
+
 
 
 Toji::Toji() : PhysicallyGifted(1000.0, 900.0) {
@@ -13,8 +17,8 @@ Toji::Toji() : PhysicallyGifted(1000.0, 900.0) {
     inventory_curse.push_back(std::make_unique<SplitSoulKatana>());
     base_attack_damage = 75.0;
 
-    char_name = "Toji Fushiguro";
-    name_color = "\033[33m";
+    static const auto toji_definition = CharacterDefinition::Make({ .name = "Toji Fushiguro", .color = "\033[33m" });
+    definition = toji_definition;
 }
 
 std::unique_ptr<Character> Toji::Clone() const {
@@ -23,51 +27,24 @@ std::unique_ptr<Character> Toji::Clone() const {
 
 void Toji::OnCharacterTurn(Battlefield& bf) {
     if (this->IsCharacterStunned()) {
-        std::println("{} is stunned and their turn will be skipped", this->GetName());
+        NARRATE(this->Out(), "{} is stunned and their turn will be skipped", this->GetName());
         return;
     }
 
-    Character* target = nullptr;
-    double best_score = -1.0;
-
-    for (const auto& t : bf.battlefield) {
-        if (t.get() == this || t->GetCharacterHealth() <= 0.0) continue;
-        
-        double hp_ratio = t->GetCharacterHealth() / t->GetCharacterMaxHealth();
-        double score = 1.0 - hp_ratio;
-
-        if (t.get()->IsaCurseUser()) {
-            auto* crs = static_cast<CurseUser*>(t.get());
-            if (auto* tech = crs->GetTechnique()) {
-                if (tech->IsLimitless()) {
-                    score += 0.15;
-                }
-            }
-        }
-        score += Utilities::GetRandomNumber(-5, 5) * 0.01;
-        if (score > best_score) {
-            best_score = score;
-            target = t.get();
-        }
-    }
+    Character* target = bf.context.Threats().Pick(this, toji_policy);
 
     if (!target) {
-        std::println("Can't find a proper sorcerer to fight these days...");
+        NARRATE(this->Out(), "Can't find a proper sorcerer to fight these days...");
         return;
     }
 
-    int tntroll = Utilities::GetRandomNumber(1, 20);
+    int tntroll = this->GetRandom().Next(1, 20);
     if (tntroll <= 10) {
         this->Taunt(target);
     }
 
     bool needs_spear = false;
-    if (target->IsaCurseUser()) {
-        auto crs = static_cast<CurseUser*>(target);
-        if (auto* tech = crs->GetTechnique()) {
-            if (tech->IsLimitless() && tech->IsInfinityActive()) needs_spear = true;
-        }
-    }
+    if (target->InfinityActive()) needs_spear = true;
     const auto& inv = this->GetCursedTools();
     if (needs_spear) {
         if (!this->GetTool() || !this->GetTool()->IsAntiTechniqueWeapon()) {
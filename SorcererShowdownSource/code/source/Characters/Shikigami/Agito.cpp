@@ -5,14 +5,14 @@
 
 
 Agito::Agito() : Shikigami(150.0) {
-    char_name = "Agito";
-    name_color = "\033[95m";
+    static const auto agito_definition = CharacterDefinition::Make({ .name = "Agito", .color = "\033[95m" });
+    definition = agito_definition;
 }
 
 void Agito::PassiveSupport(CurseUser* user) {
     if (IsActive()) {
         user->Regen(passive_heal_amount);
-        std::println("{} has healed {}",this->GetName(), user->GetNameWithID());
+        NARRATE(user->Out(), "{} has healed {}",this->GetName(), user->GetNameWithID());
     }
 }
 
@@ -22,7 +22,7 @@ void Agito::OnShikigamiTurn(CurseUser* user, Battlefield&) {
         return;
     }
     if (user->GetCharacterCE() < summon_amount) {
-        std::println("{} cannot maintain its support for {} due to insufficient Cursed Energy! It withdraws back into the shadows",this->GetName(), user->GetNameWithID());
+        NARRATE(user->Out(), "{} cannot maintain its support for {} due to insufficient Cursed Energy! It withdraws back into the shadows",this->GetName(), user->GetNameWithID());
         this->Withdraw();
         return;
     }
@@ -6,8 +6,8 @@
 
 
 Mahoraga::Mahoraga() : Shikigami(400.0) {
-    char_name = "Mahoraga";
-    name_color = "\033[33m";
+    static const auto mahoraga_definition = CharacterDefinition::Make({ .name = "Mahoraga", .color = "\033[33m" });
+    definition = mahoraga_definition;
 }
 
 void Mahoraga::Adapt() {
@@ -35,10 +35,10 @@ void Mahoraga::PrintStatus(CurseUser* s) const {
     if (PrevState != InfStage) {
         switch (InfStage) {
         case InfinityAdaptation::None: break;
-        case InfinityAdaptation::FirstSpin: std::println("{}'s {} has started to adapt space itself!!!!!", s->GetNameWithID(), this->GetName()); break;
-        case InfinityAdaptation::SecondSpin: std::println("{}'s {} is on its second spin to adapt space itself!!!!!", s->GetNameWithID(), this->GetName()); break;
-        case InfinityAdaptation::ThirdSpin: std::println("{}'s {} is on its final spin to adapt space itself!!!!!",s->GetNameWithID(), this->GetName()); break;
-        case InfinityAdaptation::FourthSpin: std::println("{}'s {} has adapted to space itself!!!!!", s->GetNameWithID(), this->GetName()); break;
+        case InfinityAdaptation::FirstSpin: NARRATE(s->Out(), "{}'s {} has started to adapt space itself!!!!!", s->GetNameWithID(), this->GetName()); break;
+        case InfinityAdaptation::SecondSpin: NARRATE(s->Out(), "{}'s {} is on its second spin to adapt space itself!!!!!", s->GetNameWithID(), this->GetName()); break;
+        case InfinityAdaptation::ThirdSpin: NARRATE(s->Out(), "{}'s {} is on its final spin to adapt space itself!!!!!",s->GetNameWithID(), this->GetName()); break;
+        case InfinityAdaptation::FourthSpin: NARRATE(s->Out(), "{}'s {} has adapted to space itself!!!!!", s->GetNameWithID(), this->GetName()); break;
         default:
             break;
         }
@@ -61,7 +61,7 @@ void Mahoraga::OnShikigamiTurn(CurseUser* user, Battlefield&) {
         return;
     }
     if (user->GetCharacterCE() < keep_active_cost) {
-        std::println("{} cannot maintain its active state due to {}'s insufficient {}Cursed Energy!{} It withdraws back into the shadows",this->GetName(), user->GetNameWithID(), Utilities::Color::Cyan, Utilities::Color::Clear);
+        NARRATE(user->Out(), "{} cannot maintain its active state due to {}'s insufficient {}Cursed Energy!{} It withdraws back into the shadows",this->GetName(), user->GetNameWithID(), Utilities::Color::Cyan, Utilities::Color::Clear);
         this->Withdraw();
         return;
     }
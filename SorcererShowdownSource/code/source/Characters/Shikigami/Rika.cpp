@@ -5,8 +5,8 @@
 
 
 Rika::Rika() : Shikigami(INT32_MAX) {
-    char_name = "Rika";
-    name_color = "\033[91m";
+    static const auto rika_definition = CharacterDefinition::Make({ .name = "Rika", .color = "\033[91m" });
+    definition = rika_definition;
 }
 
 void Rika::OnShikigamiTurn(CurseUser* user, Battlefield&) {
@@ -15,7 +15,7 @@ void Rika::OnShikigamiTurn(CurseUser* user, Battlefield&) {
     }
     if (IsActivePhysically()) {
         if (active_turn_amount >= 5) {
-            std::println("the queen of curses has reached her time limit\n{} trudges back into the shadows!", this->GetName());
+            NARRATE(user->Out(), "the queen of curses has reached her time limit\n{} trudges back into the shadows!", this->GetName());
             this->Withdraw();
             RikaCooldownRegeneration(user);
             return;
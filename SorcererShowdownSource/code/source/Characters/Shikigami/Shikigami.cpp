@@ -3,7 +3,10 @@
 
 
 Shikigami::~Shikigami() = default;
-Shikigami::Shikigami(double hp) : Character(hp) {}
+Shikigami::Shikigami(double hp) : Character(hp) {
+    flags |= KindShikigami | Intangible;
+    hit_blockers = Intangible;
+}
 
 bool Shikigami::CanBeAssignedID() const {
     return false;
@@ -11,14 +14,17 @@ bool Shikigami::CanBeAssignedID() const {
 
 void Shikigami::PartiallyManifest() {
     shikigami_state = State::Partial;
+    SetFlag(Intangible, true);
 }
 
 void Shikigami::Manifest() {
     shikigami_state = State::Full;
+    SetFlag(Intangible, false);
 }
 
 void Shikigami::Withdraw() {
     shikigami_state = State::Shadow;
+    SetFlag(Intangible, true);
 }
 
 void Shikigami::ActiveTimeIncrementor() {
@@ -52,17 +58,6 @@ std::string Shikigami::GetShikigamiStatus() const {
     }
 }
 
-bool Shikigami::IsShikigami() const {
-    return true;
-}
-
-bool Shikigami::CanBeHit() const {
-    if (IsActivePhysically()) {
-        return true;
-    }
-    return false;
-}
-
 bool Shikigami::IsMahoraga() const {
     return false;
 }
@@ -1,4 +1,5 @@
 #include "code/header/CursedTools/CursedTool.h"
+#include "code/header/CursedTools/CursedToolList.h"
 #include "code/header/Characters/PhysicallyGifted/PhysicallyGifted.h"
 #include "code/header/Characters/CurseUsers/CurseUser.h"
 #include "code/header/GameManagement/Utils.h"
@@ -13,6 +14,33 @@ double CursedTool::GetCalculatedStrength(Character* user)  const {
 	}
 }
 
+CursedTool::Kind CursedTool::GetKind() const {
+	return kind;
+}
+
+bool CursedTool::KindMatchesType() const {
+	switch (kind) {
+	case Kind::InvertedSpearOfHeaven: return typeid(*this) == typeid(InvertedSpearofHeaven);
+	case Kind::Katana: return typeid(*this) == typeid(Katana);
+	case Kind::PlayfulCloud: return typeid(*this) == typeid(PlayfulCloud);
+	case Kind::SplitSoulKatana: return typeid(*this) == typeid(SplitSoulKatana);
+	case Kind::Other: return true;
+	}
+	return false;
+}
+
+void CursedTool::DispatchUse(Character* user, Character* target) {
+	assert(KindMatchesType());
+	switch (kind) {
+	case Kind::InvertedSpearOfHeaven: static_cast<InvertedSpearofHeaven&>(*this).UseTool(user, target); return;
+	case Kind::Katana: static_cast<Katana&>(*this).UseTool(user, target); return;
+	case Kind::PlayfulCloud: static_cast<PlayfulCloud&>(*this).UseTool(user, target); return;
+	case Kind::SplitSoulKatana: static_cast<SplitSoulKatana&>(*this).UseTool(user, target); return;
+	case Kind::Other: break;
+	}
+	UseTool(user, target);
+}
+
 std::string CursedTool::GetName() const {
 	return std::format("{}{}{}", color, name, Utilities::Color::Clear);
 }
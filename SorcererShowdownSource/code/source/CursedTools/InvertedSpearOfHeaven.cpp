@@ -5,6 +5,7 @@
 
 
 InvertedSpearofHeaven::InvertedSpearofHeaven() {
+	kind = Kind::InvertedSpearOfHeaven;
 	name = "The Inverted Spear of Heaven";
 	color = "\033[33m";
 	base_damage = 50.0;
@@ -12,7 +13,7 @@ InvertedSpearofHeaven::InvertedSpearofHeaven() {
 
 void InvertedSpearofHeaven::UseTool(Character* user, Character* target) {
 	target->DamageBypass(GetCalculatedStrength(user));
-	std::println("{} {}attacks{} {} with {}", user->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, target->GetNameWithID(), this->GetName());
+	NARRATE(user->Out(), "{} {}attacks{} {} with {}", user->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, target->GetNameWithID(), this->GetName());
 }
 
 std::unique_ptr<CursedTool> InvertedSpearofHeaven::Clone() const {
@@ -6,13 +6,14 @@
 
 
 Katana::Katana() {
+	kind = Kind::Katana;
 	name = "a Katana";
 	color = "\033[36m";
 	base_damage = 50.0;
 }
 void Katana::UseTool(Character* user, Character* target) {
 	target->Damage(GetCalculatedStrength(user));
-	std::println("{} attacks {} using {}", user->GetNameWithID(), target->GetNameWithID(), this->GetName());
+	NARRATE(user->Out(), "{} attacks {} using {}", user->GetNameWithID(), target->GetNameWithID(), this->GetName());
 }
 
 std::unique_ptr<CursedTool> Katana::Clone() const {
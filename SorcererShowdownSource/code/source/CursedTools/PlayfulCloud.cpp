@@ -5,6 +5,7 @@
 
 
 PlayfulCloud::PlayfulCloud() {
+	kind = Kind::PlayfulCloud;
 	name = "Playful Cloud";
 	color = "\033[31m";
 	base_damage = 35.0;
@@ -19,7 +20,7 @@ double PlayfulCloud::GetCalculatedStrength(Character* user) const {
 }
 void PlayfulCloud::UseTool(Character* user, Character* target) {
 	target->Damage(this->GetCalculatedStrength(user));
-	std::println("{} {}attacks{} {} with {}", user->GetNameWithID(), Utilities::Color::Red, Utilities::Color::Clear, target->GetNameWithID(), this->GetName());
+	NARRATE(user->Out(), "{} {}attacks{} {} with {}", user->GetNameWithID(), Utilities::Color::Red, Utilities::Color::Clear, target->GetNameWithID(), this->GetName());
 }
 
 std::unique_ptr<CursedTool> PlayfulCloud::Clone() const {
@@ -4,6 +4,7 @@
 #include "code/header/GameManagement/Utils.h"
 
 SplitSoulKatana::SplitSoulKatana() {
+	kind = Kind::SplitSoulKatana;
 	name = "Split Soul Katana";
 	color = "\033[35m";
 	base_damage = 60.0;
@@ -11,7 +12,7 @@ SplitSoulKatana::SplitSoulKatana() {
 
 void SplitSoulKatana::UseTool(Character* user, Character* target) {
 	target->DamageBypassReinforcement(GetCalculatedStrength(user));
-	std::println("{} {}attacks{} {}'s soul with {}", user->GetNameWithID(), Utilities::Color::Red, Utilities::Color::Clear, target->GetNameWithID(), this->GetName());
+	NARRATE(user->Out(), "{} {}attacks{} {}'s soul with {}", user->GetNameWithID(), Utilities::Color::Red, Utilities::Color::Clear, target->GetNameWithID(), this->GetName());
 }
 
 std::unique_ptr<CursedTool> SplitSoulKatana::Clone() const {
@@ -4,6 +4,7 @@
 
 
 AuthenticMutualLove::AuthenticMutualLove() : Domain(600.0, 125.0, 16.0) {
+    kind = Kind::AuthenticMutualLove;
     ref_level = Refinement::Refined;
     hit_type = HitType::HitsCurseUsers;
 
@@ -16,7 +17,7 @@ AuthenticMutualLove::AuthenticMutualLove() : Domain(600.0, 125.0, 16.0) {
 void AuthenticMutualLove::OnSureHit(CurseUser&, Character& target) {
     if (IsSurehitBlocked(target)) return;
     target.DamageBypass(surehit_damage * DomainRangeMult());
-    std::println("{} got bombarded by a barrage of copied techniques inside {}!", target.GetNameWithID(), this->GetDomainName());
+    NARRATE(target.Out(), "{} got bombarded by a barrage of copied techniques inside {}!", target.GetNameWithID(), this->GetDomainName());
 }
 
 std::unique_ptr<Domain> AuthenticMutualLove::Clone() const {
@@ -1,4 +1,6 @@
 #include "code/header/Domains/Domain.h"
+#include "code/header/Domains/DomainList.h"
+#include "code/header/Domains/IdleDeathGamble.h"
 #include "code/header/Characters/CurseUsers/CurseUser.h"
 #include "code/header/Characters/Character.h"
 #include "code/header/GameManagement/Utils.h"
@@ -49,15 +51,16 @@ void Domain::DamageDomain(double damage) {
 
 void Domain::ClashDomains(CurseUser& user1, CurseUser& user2) {
     Domain* d1 = user1.GetDomain(); Domain* d2 = user2.GetDomain();
+    user1.RecordEvent({ .type = BattleEvent::Type::DomainClash, .source = user1.GetID(), .target = user2.GetID() });
 
     if (d1->GetRefinement() > d2->GetRefinement()) {
-        std::println("{}'s domain has been overwhelmed by the more refined {}", user2.GetNameWithID(), d1->GetDomainName());
+        NARRATE(user1.Out(), "{}'s domain has been overwhelmed by the more refined {}", user2.GetNameWithID(), d1->GetDomainName());
         user2.DeactivateDomain();
         d2->CollapseDomain();
         return;
     }
     else if (d1->GetRefinement() < d2->GetRefinement()) {
-        std::println("{}'s domain has been overwhelmed by the more refined {}", user1.GetNameWithID(), d2->GetDomainName());
+        NARRATE(user1.Out(), "{}'s domain has been overwhelmed by the more refined {}", user1.GetNameWithID(), d2->GetDomainName());
         user1.DeactivateDomain();
         d1->CollapseDomain();
         return;
@@ -65,24 +68,24 @@ void Domain::ClashDomains(CurseUser& user1, CurseUser& user2) {
 
     if (d1->GetDomainRange() > d2->GetDomainRange()) {
         d2->DamageDomain(d1->GetDomainStrength());
-        std::println("{} is overwhelming {}'s barrier!", d1->GetDomainName(), d2->GetDomainName());
+        NARRATE(user1.Out(), "{} is overwhelming {}'s barrier!", d1->GetDomainName(), d2->GetDomainName());
     }
     else if (d2->GetDomainRange() > d1->GetDomainRange()) {
         d1->DamageDomain(d2->GetDomainStrength());
-        std::println("{} is overwhelming {}'s barrier!", d2->GetDomainName(), d1->GetDomainName());
+        NARRATE(user1.Out(), "{} is overwhelming {}'s barrier!", d2->GetDomainName(), d1->GetDomainName());
     }
     else {
         d1->DamageDomain(d2->GetDomainStrength() * 0.5);
         d2->DamageDomain(d1->GetDomainStrength() * 0.5);
-        std::println("The domains of {} and {} are locked in an even struggle!", user1.GetNameWithID(), user2.GetNameWithID());
+        NARRATE(user1.Out(), "The domains of {} and {} are locked in an even struggle!", user1.GetNameWithID(), user2.GetNameWithID());
     }
 
     if (d1->IsDestroyed()) {
-        std::println("{}'s {} has been overwhelmed and has collapsed", user1.GetNameWithID(), d1->GetDomainName());
+        NARRATE(user1.Out(), "{}'s {} has been overwhelmed and has collapsed", user1.GetNameWithID(), d1->GetDomainName());
         KillSetDomain(user1, *d1);
     }
     else if (d2->IsDestroyed()) {
-        std::println("{}'s {} has been overwhelmed and has collapsed",user2.GetNameWithID(), d2->GetDomainName());
+        NARRATE(user1.Out(), "{}'s {} has been overwhelmed and has collapsed",user2.GetNameWithID(), d2->GetDomainName());
         KillSetDomain(user2, *d2);
     }
 }
@@ -99,6 +102,71 @@ void Domain::CollapseDomain() {
 
 void Domain::OnSureHit(CurseUser&, Character&) {}
 
+Domain::Kind Domain::GetKind() const {
+    return kind;
+}
+
+std::string_view Domain::RosterName() const {
+    switch (kind) {
+    case Kind::AuthenticMutualLove: return AuthenticMutualLove::roster_name;
+    case Kind::HollowWickerBasket: return HollowWickerBasket::roster_name;
+    case Kind::IdleDeathGamble: return IdleDeathGamble::roster_name;
+    case Kind::InfiniteVoid: return InfiniteVoid::roster_name;
+    case Kind::MalevolentShrine: return MalevolentShrine::roster_name;
+    case Kind::SelfEmbodimentOfPerfection: return SelfEmbodimentOfPerfection::roster_name;
+    case Kind::SimpleDomain: return SimpleDomain::roster_name;
+    case Kind::Other: break;
+    }
+    return name;
+}
+
+bool Domain::Tune(std::string_view key, double value) {
+    switch (kind) {
+    // neutralizers only block sure hits: they never clash and their cost is never charged
+    case Kind::HollowWickerBasket:
+    case Kind::SimpleDomain: return false;
+    // its sure hit stuns instead of dealing damage
+    case Kind::IdleDeathGamble: if (key == "surehit_damage") return false; break;
+    default: break;
+    }
+    if (key == "health") domain_health = base_health = value;
+    else if (key == "strength") domain_overwhelm_strength = value;
+    else if (key == "range") current_range = base_range = value;
+    else if (key == "domain_cost") domain_cost = value;
+    else if (key == "surehit_damage") surehit_damage = value;
+    else return false;
+    return true;
+}
+
+bool Domain::KindMatchesType() const {
+    switch (kind) {
+    case Kind::AuthenticMutualLove: return typeid(*this) == typeid(AuthenticMutualLove);
+    case Kind::HollowWickerBasket: return typeid(*this) == typeid(HollowWickerBasket);
+    case Kind::IdleDeathGamble: return typeid(*this) == typeid(IdleDeathGamble);
+    case Kind::InfiniteVoid: return typeid(*this) == typeid(InfiniteVoid);
+    case Kind::MalevolentShrine: return typeid(*this) == typeid(MalevolentShrine);
+    case Kind::SelfEmbodimentOfPerfection: return typeid(*this) == typeid(SelfEmbodimentOfPerfection);
+    case Kind::SimpleDomain: return typeid(*this) == typeid(SimpleDomain);
+    case Kind::Other: return true;
+    }
+    return false;
+}
+
+void Domain::DispatchSureHit(CurseUser& user, Character& target) {
+    assert(KindMatchesType());
+    switch (kind) {
+    case Kind::AuthenticMutualLove: static_cast<AuthenticMutualLove&>(*this).OnSureHit(user, target); return;
+    case Kind::IdleDeathGamble: static_cast<IdleDeathGamble&>(*this).OnSureHit(user, target); return;
+    case Kind::InfiniteVoid: static_cast<InfiniteVoid&>(*this).OnSureHit(user, target); return;
+    case Kind::MalevolentShrine: static_cast<MalevolentShrine&>(*this).OnSureHit(user, target); return;
+    case Kind::SelfEmbodimentOfPerfection: static_cast<SelfEmbodimentOfPerfection&>(*this).OnSureHit(user, target); return;
+    case Kind::HollowWickerBasket:
+    case Kind::SimpleDomain: return; // neutralizers have no sure hit
+    case Kind::Other: break;
+    }
+    OnSureHit(user, target);
+}
+
 double Domain::GetUseCost() const {
     return domain_cost;
 }
@@ -108,13 +176,13 @@ bool Domain::IsSurehitBlocked(Character& target) const {
     if (target.IsaCurseUser()){
         auto s = static_cast<CurseUser*>(&target);
         if (s->CounterDomainActive()){
-            std::println("{} protected himself from the {}'s surehit by using {}!", s->GetNameWithID(), this->GetDomainName(), s->GetCounterDomain()->GetDomainName());
+            NARRATE(target.Out(), "{} protected himself from the {}'s surehit by using {}!", s->GetNameWithID(), this->GetDomainName(), s->GetCounterDomain()->GetDomainName());
             return true;
         }
         return false;
     }
     if (hit_type == HitType::HitsCurseUsers && target.IsPhysicallyGifted()) {
-        std::println("{} couldn't detect {} due to their heavenly restriction\n"
+        NARRATE(target.Out(), "{} couldn't detect {} due to their heavenly restriction\n"
                     "The domain's surehit didn't work!", GetDomainName(), target.GetNameWithID());
         return true;
     }
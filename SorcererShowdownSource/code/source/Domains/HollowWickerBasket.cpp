@@ -4,6 +4,7 @@
 
 
 HollowWickerBasket::HollowWickerBasket() : Domain(150.0, 2, 2) {
+    kind = Kind::HollowWickerBasket;
     is_neutralizer = true;
     name = "Hollow Wicker Basket";
     color = "\033[95m";
@@ -7,6 +7,7 @@
 
 
 IdleDeathGamble::IdleDeathGamble() : Domain(800.0, 150.0, 16.0) {
+    kind = Kind::IdleDeathGamble;
     ref_level = Refinement::Absolute;
     hit_type = HitType::HitsEveryone;
     name = "Idle Death Gamble";
@@ -19,12 +20,12 @@ void IdleDeathGamble::SetJackpot(bool t) {
 void IdleDeathGamble::OnSureHit(CurseUser& user, Character& target) {
     if (jackpot) return;
     if (!info_dumped) {
-        DumpInfo();
+        DumpInfo(user.Out());
         info_dumped = true;
     }
     target.SetStunState(true);
-    if (Utilities::GetRandomNumber(1, 239) <= luck) {
-        std::println("\033[92m!!!!!!!!!!!JACKPOT!!!!!!!!!!\033[0m");
+    if (user.GetRandom().Next(1, 239) <= luck) {
+        NARRATE(user.Out(), "\033[92m!!!!!!!!!!!JACKPOT!!!!!!!!!!\033[0m");
         jackpot = true; luck = std::max(luck / 10, 1); // hit jackpot, divide luck
         this->KillSetDomain(user, *this); // break domain and reset stats for next use
         user.GetTechnique()->Set(Technique::Status::Usable); // make sure they can still use their technique
@@ -32,7 +33,7 @@ void IdleDeathGamble::OnSureHit(CurseUser& user, Character& target) {
     else {
         luck = std::min(luck * 2, 239);
     }
-    std::println("{} got stunned by {}'s SureHit!", target.GetNameWithID(), this->GetDomainName());
+    NARRATE(user.Out(), "{} got stunned by {}'s SureHit!", target.GetNameWithID(), this->GetDomainName());
 
 }
 
@@ -44,8 +45,8 @@ std::unique_ptr<Domain> IdleDeathGamble::Clone() const {
     return std::make_unique<IdleDeathGamble>(*this);
 }
 
-void IdleDeathGamble::DumpInfo() {
-    std::println("\033[92mIDLE DEATH GAMBLE: DOMAIN RULES\033[0m\n"
+void IdleDeathGamble::DumpInfo(OutputSink& out) {
+    NARRATE(out, "\033[92mIDLE DEATH GAMBLE: DOMAIN RULES\033[0m\n"
         "The SureHit: (Rule Transmission) When the domain is activated, the target is immediately stunned. This represents the mandatory information dump where the rules of the game are forced into the target's brain.\n"
         "The Jackpot Roll: The user rolls for a Jackpot with a base probability of 1 in 239.\n"
         "The Pity System: (Luck Boost) Every time the user fails a roll, his luck value doubles. This continues until the value hits 239, effectively guaranteeing a Jackpot eventually.\n"
@@ -4,6 +4,7 @@
 
 
 InfiniteVoid::InfiniteVoid() : Domain(800.0, 150.0, 16.0) {
+    kind = Kind::InfiniteVoid;
     ref_level = Refinement::Absolute;
     hit_type = HitType::HitsCurseUsers;
     name = "Infinite Void";
@@ -15,7 +16,7 @@ void InfiniteVoid::OnSureHit(CurseUser&, Character& target) {
     if (IsSurehitBlocked(target)) return;
     target.DamageBypass(surehit_damage * DomainRangeMult());
     target.SetStunState(true);
-    std::println("{} got hit by {}'s SureHit!", target.GetNameWithID(), this->GetDomainName());
+    NARRATE(target.Out(), "{} got hit by {}'s SureHit!", target.GetNameWithID(), this->GetDomainName());
 }
 
 std::unique_ptr<Domain> InfiniteVoid::Clone() const {
@@ -4,6 +4,7 @@
 
 
 MalevolentShrine::MalevolentShrine() : Domain(1000.0, 300.0, 20.0) {
+    kind = Kind::MalevolentShrine;
     ref_level = Refinement::Absolute;
     hit_type = HitType::HitsEveryone;
     name = "Malevolent Shrine";
@@ -14,7 +15,7 @@ MalevolentShrine::MalevolentShrine() : Domain(1000.0, 300.0, 20.0) {
 void MalevolentShrine::OnSureHit(CurseUser&, Character& target) {
     if (IsSurehitBlocked(target)) return;
     target.DamageBypass(surehit_damage * DomainRangeMult());
-    std::println("{} got hit by {}'s SureHit!", target.GetNameWithID(), this->GetDomainName());
+    NARRATE(target.Out(), "{} got hit by {}'s SureHit!", target.GetNameWithID(), this->GetDomainName());
 }
 
 std::unique_ptr<Domain> MalevolentShrine::Clone() const {
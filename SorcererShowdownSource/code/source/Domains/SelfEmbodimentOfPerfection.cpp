@@ -4,6 +4,7 @@
 
 
 SelfEmbodimentOfPerfection::SelfEmbodimentOfPerfection() : Domain(500.0, 100.0, 16.0) {
+    kind = Kind::SelfEmbodimentOfPerfection;
     ref_level = Refinement::Refined;
     hit_type = HitType::HitsCurseUsers;
     name = "Self Embodiment Of Perfection";
@@ -14,7 +15,7 @@ SelfEmbodimentOfPerfection::SelfEmbodimentOfPerfection() : Domain(500.0, 100.0,
 void SelfEmbodimentOfPerfection::OnSureHit(CurseUser&, Character& target) {
     if (IsSurehitBlocked(target)) return;
     target.DamageBypass(surehit_damage * DomainRangeMult());
-    std::println("{} got hit by {}'s SureHit!", target.GetNameWithID(), this->GetDomainName());
+    NARRATE(target.Out(), "{} got hit by {}'s SureHit!", target.GetNameWithID(), this->GetDomainName());
 }
 
 std::unique_ptr<Domain> SelfEmbodimentOfPerfection::Clone() const {
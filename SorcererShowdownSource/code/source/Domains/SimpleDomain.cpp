@@ -4,6 +4,7 @@
 
 
 SimpleDomain::SimpleDomain() : Domain(INT32_MAX, 3, 3) {
+    kind = Kind::SimpleDomain;
     is_neutralizer = true;
     name = "Simple Domain";
     color = "\033[36m";
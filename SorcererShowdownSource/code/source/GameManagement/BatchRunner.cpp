@@ -0,0 +1,395 @@
+#include "code/header/GameManagement/BatchRunner.h"
+#include "code/header/GameManagement/BattleManager.h"
+#include "code/header/GameManagement/BattlefieldHeader.h"
+#include "code/header/Characters/Character.h"
+
+
+
+const Character* BatchRunner::FindRosterEntry(const BattleCreator& bc, const std::string& name) {
+	return bc.characterlist.Find(name);
+}
+
+static bool ParseSeed(const std::string& text, std::uint64_t& out) {
+	try {
+		size_t used = 0;
+		out = std::stoull(text, &used, 0);
+		return used == text.size();
+	}
+	catch (const std::exception&) {
+		return false;
+	}
+}
+
+static bool ParseCount(const std::string& text, int& out) {
+	try {
+		size_t used = 0;
+		out = std::stoi(text, &used);
+		return used == text.size();
+	}
+	catch (const std::exception&) {
+		return false;
+	}
+}
+
+bool BatchRunner::IsBatchRequest(int argc, char* argv[]) {
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "--batch" || arg == "--matrix") return true;
+	}
+	return false;
+}
+
+void BatchRunner::PrintUsage() {
+	std::println(stderr, "Usage: SorcererShowdown --batch --fighter NAME[=COUNT] [--fighter ...] [options]");
+	std::println(stderr, "  --fighter NAME[=COUNT]  add COUNT copies (default 1) of the roster entry NAME");
+	std::println(stderr, "  --roster PATH           also load characters from a file (e.g. characters.json) or a directory of them");
+	std::println(stderr, "  --tuning FILE           technique and domain constants to use (default tuning.json when present)");
+	std::println(stderr, "  --battles N             number of battles to run (default 1)");
+	std::println(stderr, "  --turn-cap N            end a battle as undecided after N rounds, 0 for no cap (default 500)");
+	std::println(stderr, "  --threads N             worker threads, 0 for one per core (default 1)");
+	std::println(stderr, "  --seed S                seed of the first battle, battle k uses S + k - 1 (default random)");
+	std::println(stderr, "  --log FILE              write every battle's narration to FILE, - for stdout (default off)");
+	std::println(stderr, "  --events FILE           write every battle's event stream to FILE as CSV (default off)");
+	std::println(stderr, "");
+	std::println(stderr, "       SorcererShowdown --matrix [--fighter NAME ...] [options]");
+	std::println(stderr, "  plays every pair of roster entries (or of the given fighters) --battles times each");
+	std::println(stderr, "  --output FILE           write the matrix to FILE instead of stdout");
+	std::println(stderr, "  --format csv|json       matrix output format (default csv)");
+}
+
+bool BatchRunner::ParseArgs(int argc, char* argv[], BatchOptions& options) {
+	for (int i = 1; i < argc; i++) {
+		std::string arg = argv[i];
+		if (arg == "--batch") continue;
+		if (arg == "--matrix") {
+			options.matrix = true;
+			continue;
+		}
+		if (arg == "--help") return false;
+
+		if (i + 1 >= argc) {
+			std::println(stderr, "Missing value for {}", arg);
+			return false;
+		}
+		std::string value = argv[++i];
+
+		if (arg == "--roster") {
+			options.roster_path = value;
+		}
+		else if (arg == "--tuning") {
+			if (!std::filesystem::exists(value)) {
+				std::println(stderr, "Could not find tuning table \"{}\"", value);
+				return false;
+			}
+			options.tuning_path = value;
+		}
+		else if (arg == "--log") {
+			options.log_path = value;
+		}
+		else if (arg == "--events") {
+			options.events_path = value;
+		}
+		else if (arg == "--output") {
+			options.output_path = value;
+		}
+		else if (arg == "--format") {
+			if (value != "csv" && value != "json") {
+				std::println(stderr, "Invalid format \"{}\", expected csv or json", value);
+				return false;
+			}
+			options.format = value;
+		}
+		else if (arg == "--fighter") {
+			int count = 1;
+			size_t eq = value.rfind('=');
+			if (eq != std::string::npos) {
+				if (!ParseCount(value.substr(eq + 1), count) || count < 1) {
+					std::println(stderr, "Invalid fighter count in \"{}\"", value);
+					return false;
+				}
+				value.resize(eq);
+			}
+			options.fighters.emplace_back(value, count);
+		}
+		else if (arg == "--battles") {
+			if (!ParseCount(value, options.battles) || options.battles < 1) {
+				std::println(stderr, "Invalid battle count \"{}\"", value);
+				return false;
+			}
+		}
+		else if (arg == "--turn-cap") {
+			if (!ParseCount(value, options.turn_cap) || options.turn_cap < 0) {
+				std::println(stderr, "Invalid turn cap \"{}\"", value);
+				return false;
+			}
+		}
+		else if (arg == "--threads") {
+			if (!ParseCount(value, options.threads) || options.threads < 0) {
+				std::println(stderr, "Invalid thread count \"{}\"", value);
+				return false;
+			}
+		}
+		else if (arg == "--seed") {
+			if (!ParseSeed(value, options.seed)) {
+				std::println(stderr, "Invalid seed \"{}\"", value);
+				return false;
+			}
+			options.seeded = true;
+		}
+		else {
+			std::println(stderr, "Unknown option {}", arg);
+			return false;
+		}
+	}
+
+	if (options.matrix) return true;
+
+	int total = 0;
+	for (const auto& [name, count] : options.fighters) total += count;
+	if (total < 2) {
+		std::println(stderr, "You need 2 or more fighters to start a battle");
+		return false;
+	}
+	return true;
+}
+
+void BatchRunner::LoadRoster(BattleCreator& bc, const BatchOptions& options) {
+	Battlefield roster_bf;
+	bc.interactive = false;
+	bool load = !options.roster_path.empty();
+	if (load) bc.roster_path = options.roster_path;
+	if (!options.tuning_path.empty()) bc.tuning_path = options.tuning_path;
+	else if (options.matrix) load = std::filesystem::exists(bc.roster_path);
+	BattleManager::loadSetup(roster_bf, bc, load);
+}
+
+int BatchRunner::ThreadCount(const BatchOptions& options, std::int64_t jobs) {
+	int threads = options.threads > 0 ? options.threads : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+	return static_cast<int>(std::max<std::int64_t>(1, std::min<std::int64_t>(threads, jobs)));
+}
+
+int BatchRunner::Run(const BatchOptions& options) {
+	BattleCreator bc;
+	LoadRoster(bc, options);
+
+	for (const auto& [name, count] : options.fighters) {
+		if (!bc.characterlist.Build(name)) {
+			std::println(stderr, "Unknown fighter \"{}\", available:", name);
+			for (size_t i = 0; i < bc.characterlist.Size(); i++) {
+				std::println(stderr, "  {}", bc.characterlist.Name(i));
+			}
+			return 1;
+		}
+	}
+
+	BatchOptions run_options = options;
+	if (!run_options.seeded) run_options.seed = BattleRandom::RandomSeed();
+
+	int threads = ThreadCount(options, options.battles);
+
+	std::vector<BattleResult> results(static_cast<size_t>(options.battles));
+	std::vector<BatchTally> tallies(static_cast<size_t>(threads));
+	std::atomic<int> next_battle = 0;
+
+	std::unique_ptr<FileSink> log_file;
+	if (options.log_path == "-") {
+		log = &OutputSink::Stdout();
+	}
+	else if (!options.log_path.empty()) {
+		log_file = std::make_unique<FileSink>(options.log_path);
+		if (!log_file->IsOpen()) {
+			std::println(stderr, "Could not open log file \"{}\"", options.log_path);
+			return 1;
+		}
+		log = log_file.get();
+	}
+
+	std::unique_ptr<FileSink> event_file;
+	if (!options.events_path.empty()) {
+		event_file = std::make_unique<FileSink>(options.events_path);
+		if (!event_file->IsOpen()) {
+			std::println(stderr, "Could not open event file \"{}\"", options.events_path);
+			return 1;
+		}
+		event_file->Write("battle,round,event,damage_kind,source,target,amount,detail");
+		event_log = event_file.get();
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	{
+		std::vector<std::jthread> workers;
+		for (auto& tally : tallies) {
+			workers.emplace_back([&, this] { RunWorker(bc, run_options, next_battle, results, tally); });
+		}
+	}
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	log = nullptr;
+	event_log = nullptr;
+
+	std::println("battle,seed,outcome,winner,winner_id,winner_hp,rounds");
+	for (size_t i = 0; i < results.size(); i++) {
+		PrintResult(static_cast<int>(i) + 1, results[i]);
+	}
+
+	BatchTally total;
+	for (const auto& tally : tallies) total.Merge(tally);
+	PrintSummary(total, threads, run_options.seed, elapsed.count());
+	return 0;
+}
+
+void BatchRunner::RunWorker(const BattleCreator& bc, const BatchOptions& options, std::atomic<int>& next_battle, std::vector<BattleResult>& results, BatchTally& tally) {
+	while (true) {
+		int i = next_battle.fetch_add(1, std::memory_order_relaxed);
+		if (i >= options.battles) return;
+		Battlefield bf;
+		bf.context.Reseed(options.seed + static_cast<std::uint64_t>(i));
+		bf.context.Config().turn_cap = options.turn_cap;
+		bf.context.Config().spectator_mode = true;
+		MemorySink transcript;
+		if (log) bf.context.SetSink(transcript);
+		else bf.context.SetSink(std::make_unique<NullSink>());
+		if (event_log) bf.context.Events().Record(true);
+		PopulateBattlefield(bf, bc, options);
+		BattleResult& result = results[static_cast<size_t>(i)];
+		result = RunBattle(bf);
+		result.seed = bf.context.GetSeed();
+		tally.Add(result);
+		if (log) WriteTranscript(i + 1, result.seed, transcript);
+		if (event_log) WriteEvents(i + 1, bf.context.Events());
+	}
+}
+
+void BatchRunner::PopulateBattlefield(Battlefield& bf, const BattleCreator& bc, const BatchOptions& options) {
+	for (const auto& [name, count] : options.fighters) {
+		const Character* entry = FindRosterEntry(bc, name);
+		for (int n = 0; n < count; n++) {
+			AddFighter(bf, *entry);
+		}
+	}
+}
+
+void BatchRunner::AddFighter(Battlefield& bf, const Character& entry) {
+	BattleArena::Scope scope(bf.arena);
+	std::unique_ptr<Character> fighter = entry.Clone();
+	fighter->JoinBattle(bf.context);
+	bf.battlefield.push_back(std::move(fighter));
+	bf.context.Enlist(*bf.battlefield.back(), bf.battlefield.size() - 1);
+}
+
+bool BatchRunner::PlayRound(Battlefield& bf, BattleManager& manager, BattleResult& result, BattleTiming* timing) {
+	BattleArena::Scope scope(bf.arena);
+	bool game_over = false;
+	result.rounds++;
+	bf.context.BeginRound();
+	for (const auto& s : bf.battlefield) {
+		if (s->GetCharacterHealth() <= 0.0) continue;
+		bf.context.BeginTurn(s->GetID());
+		result.turns++;
+		if (timing) {
+			auto turn_start = std::chrono::steady_clock::now();
+			s->OnCharacterTurn(bf);
+			timing->decision_time += std::chrono::steady_clock::now() - turn_start;
+			timing->decisions++;
+		}
+		else {
+			s->OnCharacterTurn(bf);
+		}
+		if (manager.GameEndCheck(bf, true)) {
+			game_over = true;
+			break;
+		}
+	}
+	manager.DomainCheckAndPerform(bf);
+	bool player_found = manager.ManageEndOfTurn(bf, true);
+	manager.SpawnNewFighters(bf);
+	return manager.IsBattleOver(game_over, player_found, true, bf);
+}
+
+BattleResult BatchRunner::RunBattle(Battlefield& bf, BattleTiming* timing) {
+	BattleManager manager;
+	const int turn_cap = bf.context.Config().turn_cap;
+	BattleResult result;
+	bool capped = false;
+
+	while (!PlayRound(bf, manager, result, timing)) {
+		if (turn_cap > 0 && result.rounds >= turn_cap) {
+			capped = true;
+			break;
+		}
+	}
+
+	if (bf.battlefield.size() == 1) {
+		const auto& winner = bf.battlefield[0];
+		result.outcome = BattleResult::Outcome::Win;
+		result.winner = winner->GetSimpleName();
+		result.winner_id = winner->GetID();
+		result.winner_health = winner->GetCharacterHealth();
+	}
+	else if (capped) {
+		result.outcome = BattleResult::Outcome::TurnCap;
+	}
+	else {
+		result.outcome = BattleResult::Outcome::Draw;
+	}
+	return result;
+}
+
+void BatchRunner::WriteTranscript(int battle, std::uint64_t seed, const MemorySink& transcript) {
+	std::lock_guard lock(log_mutex);
+	log->Line("===== Battle {} (seed {}) =====", battle, seed);
+	log->Write(transcript.Contents());
+}
+
+void BatchRunner::WriteEvents(int battle, const EventStream& events) {
+	std::string block;
+	for (const BattleEvent& e : events.Events()) {
+		std::format_to(std::back_inserter(block), "{},{},{},{},{},{},{:.1f},{}\n", battle, e.round, BattleEvent::TypeName(e.type),
+			BattleEvent::DamageKindName(e.damage), e.source, e.target, e.amount, e.detail);
+	}
+	if (block.empty()) return;
+	block.pop_back();
+	event_log->Write(block);
+}
+
+void BatchRunner::PrintResult(int battle, const BattleResult& result) {
+	switch (result.outcome) {
+	case BattleResult::Outcome::Win:
+		std::println("{},{},win,{},{},{:.1f},{}", battle, result.seed, result.winner, result.winner_id, result.winner_health, result.rounds);
+		break;
+	case BattleResult::Outcome::Draw:
+		std::println("{},{},draw,,,,{}", battle, result.seed, result.rounds);
+		break;
+	case BattleResult::Outcome::TurnCap:
+		std::println("{},{},turn_cap,,,,{}", battle, result.seed, result.rounds);
+		break;
+	}
+}
+
+void BatchRunner::PrintSummary(const BatchTally& total, int threads, std::uint64_t seed, double seconds) {
+	std::println(stderr, "{} battles from seed {} on {} thread(s) in {:.2f}s ({:.1f} battles/s, {:.1f} rounds avg)",
+		total.battles, seed, threads, seconds, seconds > 0.0 ? total.battles / seconds : 0.0,
+		total.battles > 0 ? static_cast<double>(total.rounds) / total.battles : 0.0);
+	for (const auto& [name, wins] : total.wins) {
+		std::println(stderr, "  {}: {} wins ({:.1f}%)", name, wins, 100.0 * wins / total.battles);
+	}
+	if (total.draws > 0) std::println(stderr, "  draws: {}", total.draws);
+	if (total.turn_caps > 0) std::println(stderr, "  turn cap reached: {}", total.turn_caps);
+}
+
+void BatchTally::Add(const BattleResult& result) {
+	battles++;
+	rounds += result.rounds;
+	switch (result.outcome) {
+	case BattleResult::Outcome::Win: wins[result.winner]++; break;
+	case BattleResult::Outcome::Draw: draws++; break;
+	case BattleResult::Outcome::TurnCap: turn_caps++; break;
+	}
+}
+
+void BatchTally::Merge(const BatchTally& other) {
+	for (const auto& [name, count] : other.wins) wins[name] += count;
+	battles += other.battles;
+	draws += other.draws;
+	turn_caps += other.turn_caps;
+	rounds += other.rounds;
+}
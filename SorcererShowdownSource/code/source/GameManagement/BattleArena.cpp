@@ -0,0 +1,45 @@
+#include "code/header/GameManagement/BattleArena.h"
+
+namespace {
+	// Every block starts with the arena it came from (nullptr for the global
+	// heap), padded so the object itself keeps operator new's alignment.
+	constexpr size_t header_size = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+	constexpr size_t first_block_size = 16 * 1024;
+}
+
+thread_local BattleArena* BattleArena::current = nullptr;
+
+BattleArena::BattleArena() : resource(first_block_size) {}
+
+BattleArena::Stats BattleArena::GetStats() const {
+	return { bytes_used, allocations };
+}
+
+BattleArena::Scope::Scope(BattleArena& arena) : previous(current) {
+	current = &arena;
+}
+
+BattleArena::Scope::~Scope() {
+	current = previous;
+}
+
+void* BattleArena::Allocate(size_t size) {
+	const size_t total = header_size + size;
+	void* block = nullptr;
+	if (BattleArena* arena = current) {
+		block = arena->resource.allocate(total, header_size);
+		arena->bytes_used += total;
+		arena->allocations++;
+	}
+	else {
+		block = ::operator new(total);
+	}
+	*static_cast<BattleArena**>(block) = current;
+	return static_cast<std::byte*>(block) + header_size;
+}
+
+void BattleArena::Free(void* p) noexcept {
+	if (!p) return;
+	void* block = static_cast<std::byte*>(p) - header_size;
+	if (*static_cast<BattleArena**>(block) == nullptr) ::operator delete(block);
+}
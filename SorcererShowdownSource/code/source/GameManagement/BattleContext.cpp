@@ -0,0 +1,121 @@
+#include "code/header/GameManagement/BattleContext.h"
+#include "code/header/Characters/Character.h"
+
+namespace {
+	// Fighter streams are keyed by their positive IDs and the battle draws from 0.
+	constexpr std::uint64_t threat_stream = ~std::uint64_t{ 0 };
+}
+
+BattleContext::BattleContext() : BattleContext(0) {}
+
+BattleContext::BattleContext(std::uint64_t seed) : rng(seed) {
+	threats.Reseed(rng.Stream(threat_stream));
+}
+
+int BattleContext::NextID() {
+	return ++issued_ids;
+}
+
+void BattleContext::ResetIDs(int issued) {
+	issued_ids = issued;
+}
+
+int BattleContext::IssuedIDs() const {
+	return issued_ids;
+}
+
+void BattleContext::Reseed(std::uint64_t seed) {
+	rng.Reseed(seed);
+	threats.Reseed(rng.Stream(threat_stream));
+}
+
+std::uint64_t BattleContext::GetSeed() const {
+	return rng.GetSeed();
+}
+
+BattleRandom& BattleContext::Random() {
+	return rng;
+}
+
+BattleRandom BattleContext::CharacterStream(int id) const {
+	return rng.Stream(static_cast<std::uint64_t>(id));
+}
+
+BattleConfig& BattleContext::Config() {
+	return config;
+}
+
+const BattleConfig& BattleContext::Config() const {
+	return config;
+}
+
+void BattleContext::SetSink(std::unique_ptr<OutputSink> owned) {
+	owned_sink = std::move(owned);
+	sink = owned_sink ? owned_sink.get() : &OutputSink::Stdout();
+}
+
+void BattleContext::SetSink(OutputSink& shared) {
+	owned_sink.reset();
+	sink = &shared;
+}
+
+OutputSink& BattleContext::Out() const {
+	return *sink;
+}
+
+EventStream& BattleContext::Events() {
+	return events;
+}
+
+const EventStream& BattleContext::Events() const {
+	return events;
+}
+
+BattlefieldIndex& BattleContext::Index() {
+	return index;
+}
+
+const BattlefieldIndex& BattleContext::Index() const {
+	return index;
+}
+
+ThreatBoard& BattleContext::Threats() {
+	threats.Refresh(index, stats);
+	return threats;
+}
+
+void BattleContext::TraitsChanged(const Character& fighter) {
+	threats.TraitsChanged(index.SlotOf(fighter.GetID()), fighter);
+}
+
+FighterStats& BattleContext::Stats() {
+	return stats;
+}
+
+TurnScratch& BattleContext::Scratch() {
+	return scratch;
+}
+
+void BattleContext::BeginRound() {
+	events.BeginRound();
+	threats.BeginRound();
+}
+
+void BattleContext::BeginTurn(int id) {
+	scratch.Reset();
+	events.BeginTurn(id);
+}
+
+void BattleContext::Enlist(Character& fighter, size_t slot) {
+	fighter.AttachStats(stats);
+	index.Add(&fighter, slot);
+}
+
+void BattleContext::Reindex(const std::vector<std::unique_ptr<Character>>& battlefield) {
+	ScratchVector<size_t> kept(&scratch);
+	kept.reserve(battlefield.size());
+	for (const auto& fighter : battlefield) kept.push_back(fighter->GetStatSlot());
+	stats.Compact(kept);
+	for (size_t slot = 0; slot < battlefield.size(); slot++) battlefield[slot]->SetStatSlot(slot);
+	index.Rebuild(battlefield);
+}
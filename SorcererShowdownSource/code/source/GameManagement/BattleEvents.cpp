@@ -0,0 +1,70 @@
+#include "code/header/GameManagement/BattleEvents.h"
+
+std::string_view BattleEvent::TypeName(Type type) {
+	switch (type) {
+	case Type::Damage: return "damage";
+	case Type::Heal: return "heal";
+	case Type::CESpent: return "ce_spent";
+	case Type::DomainActivated: return "domain_activated";
+	case Type::DomainClash: return "domain_clash";
+	case Type::DomainCollapsed: return "domain_collapsed";
+	case Type::BlackFlash: return "black_flash";
+	case Type::Spawn: return "spawn";
+	case Type::Removed: return "removed";
+	}
+	return "unknown";
+}
+
+std::string_view BattleEvent::DamageKindName(DamageKind kind) {
+	switch (kind) {
+	case DamageKind::None: return "";
+	case DamageKind::Normal: return "normal";
+	case DamageKind::Bypass: return "bypass";
+	case DamageKind::BypassReinforcement: return "bypass_reinforcement";
+	case DamageKind::BypassAll: return "bypass_all";
+	}
+	return "";
+}
+
+void EventStream::Emit(BattleEvent event) {
+	if (!Listening()) return;
+	event.round = round;
+	if (recording) events.push_back(event);
+	for (const auto& [id, callback] : subscribers) {
+		callback(event);
+	}
+}
+
+void EventStream::Record(bool r) {
+	recording = r;
+}
+
+int EventStream::Subscribe(std::function<void(const BattleEvent&)> callback) {
+	subscribers.emplace_back(++next_subscriber, std::move(callback));
+	return next_subscriber;
+}
+
+void EventStream::Unsubscribe(int id) {
+	std::erase_if(subscribers, [id](const auto& s) { return s.first == id; });
+}
+
+std::span<const BattleEvent> EventStream::Events() const {
+	return events;
+}
+
+void EventStream::BeginRound() {
+	round++;
+	actor = 0;
+}
+
+void EventStream::BeginTurn(int actor_id) {
+	actor = actor_id;
+}
+
+int EventStream::Round() const {
+	return round;
+}
+
+int EventStream::Actor() const {
+	return actor;
+}
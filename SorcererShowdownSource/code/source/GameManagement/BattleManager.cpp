@@ -9,18 +9,9 @@
 #include "code/header/GameManagement/Utils.h"
 
 bool BattleManager::GameEndCheck(Battlefield& bf, bool spectator_mode) {
-	int alive_sorcerers = 0;
-	bool player_found = false;
-
-	for (const auto& sc : bf.battlefield) {
-		if (sc->GetCharacterHealth() > 0) {
-			alive_sorcerers++;
-			if (sc->IsThePlayer()) player_found = true;
-		}
-	}
-
-	if (!spectator_mode && !player_found) return true;
-	if (alive_sorcerers <= 1) return true;
+	const BattlefieldIndex& index = bf.context.Index();
+	if (!spectator_mode && !index.PlayerAlive()) return true;
+	if (index.AliveCount() <= 1) return true;
 	return false;
 }
 
@@ -39,19 +30,16 @@ std::pair<bool, bool> BattleManager::SkipTurnFullyCheck() {
 }
 
 void BattleManager::loadSetup(Battlefield& bf, BattleCreator& bc, bool load = false) {
-	if (!bc.characterlist.empty()) bc.characterlist.clear();
-	bc.characterlist.push_back(std::make_unique<Gojo>());
-	bc.characterlist.push_back(std::make_unique<Sukuna>());
-	bc.characterlist.push_back(std::make_unique<Yuta>());
-	bc.characterlist.push_back(std::make_unique<Toji>());
-	bc.characterlist.push_back(std::make_unique<Mahito>());
-	bc.characterlist.push_back(std::make_unique<Hakari>());
-	if (load) {
-		CharacterCreator cc;
-		cc.LoadJsonObject(bc);
-	}
-	Character::ResetGlobalID();
-	Character::AddGlobalID(static_cast<int>(bf.battlefield.size()));
+	bc.characterlist.Clear();
+	CharacterCreator cc;
+	cc.LoadTuning(bc);
+	bc.characterlist.Add(std::make_unique<Gojo>());
+	bc.characterlist.Add(std::make_unique<Sukuna>());
+	bc.characterlist.Add(std::make_unique<Yuta>());
+	bc.characterlist.Add(std::make_unique<Toji>());
+	bc.characterlist.Add(std::make_unique<Mahito>());
+	bc.characterlist.Add(std::make_unique<Hakari>());
+	if (load) cc.LoadJsonObject(bc);
 }
 
 bool BattleManager::SetupBattlefield(Battlefield& bf,BattleCreator& bc) {
@@ -70,10 +58,11 @@ bool BattleManager::SetupBattlefield(Battlefield& bf,BattleCreator& bc) {
 		}
 		std::println("\n");
 		int i = 1;
-		for (const auto& s : bc.characterlist) {
+		for (size_t n = 0; n < bc.characterlist.Size(); n++) {
+			const Character* s = bc.characterlist.At(n);
 			double hp = s->GetCharacterHealth();
 			if (s->IsaCurseUser()){
-				auto crs = static_cast<CurseUser*>(s.get());
+				auto crs = static_cast<const CurseUser*>(s);
 				auto technigue = crs->GetTechnique() ? crs->GetTechnique()->GetTechniqueName() : "None";
 				auto domain = crs->GetDomain() ? crs->GetDomain()->GetDomainName() : "None";
 				auto counter = crs->GetCounterDomain() ? crs->GetCounterDomain()->GetDomainName() : "None";
@@ -81,7 +70,7 @@ bool BattleManager::SetupBattlefield(Battlefield& bf,BattleCreator& bc) {
 				i++;
 				continue;
 			}else if (s->IsPhysicallyGifted()){
-				auto pg = static_cast<PhysicallyGifted*>(s.get());
+				auto pg = static_cast<const PhysicallyGifted*>(s);
 				std::println("{}: {} (HP: {:.1f}|Strength: {:.1f})\n",i, s->GetName(), hp, pg->GetStrength());
 				i++;
 				continue;
@@ -93,13 +82,15 @@ bool BattleManager::SetupBattlefield(Battlefield& bf,BattleCreator& bc) {
 		
 		int c = Utilities::GetValidInput();
 
-		if (c > 0 && c <= static_cast<int>(bc.characterlist.size())) 
+		if (c > 0 && c <= static_cast<int>(bc.characterlist.Size())) 
 		{
 			size_t idx = static_cast<size_t>(c - 1);
-			std::unique_ptr<Character> new_character = bc.characterlist[idx]->Clone();
-			new_character->AssignID();
+			BattleArena::Scope scope(bf.arena);
+			std::unique_ptr<Character> new_character = bc.characterlist.At(idx)->Clone();
+			new_character->JoinBattle(bf.context);
 			bc.fighter_counts[new_character->GetName()]++;
 			bf.battlefield.push_back(std::move(new_character));
+			bf.context.Enlist(*bf.battlefield.back(), bf.battlefield.size() - 1);
 			UserInterface::ClearScreen();
 		}
 		else if (c == 0) 
@@ -117,7 +108,8 @@ bool BattleManager::SetupBattlefield(Battlefield& bf,BattleCreator& bc) {
 		{
 			bc.fighter_counts[bf.battlefield.back()->GetName()]--;
 			bf.battlefield.pop_back();
-			Character::AddGlobalID(-1);
+			bf.context.ResetIDs(static_cast<int>(bf.battlefield.size()));
+			bf.context.Reindex(bf.battlefield);
 			UserInterface::ClearScreen();
 		}
 		else if (c == -2) 
@@ -137,36 +129,55 @@ bool BattleManager::SetupBattlefield(Battlefield& bf,BattleCreator& bc) {
 }
 
 void BattleManager::SpawnNewFighters(Battlefield& bf) {
-	for (auto& new_unit : bf.spawn_queue) {
-		new_unit->AssignID();
+	for (auto& new_unit : bf.spawns.Pending()) {
+		new_unit->JoinBattle(bf.context);
+		new_unit->RecordEvent({ .type = BattleEvent::Type::Spawn, .target = new_unit->GetID(), .amount = new_unit->GetCharacterHealth() });
 		bf.battlefield.push_back(std::move(new_unit));
+		bf.context.Enlist(*bf.battlefield.back(), bf.battlefield.size() - 1);
 	}
-	bf.spawn_queue.clear();
+	bf.spawns.ClearPending();
 }
 
 bool BattleManager::ManageEndOfTurn(Battlefield& bf, bool spectator_mode) {
-	std::println("{}=============== TURN AFTERMATH ==============={}", Utilities::Color::BrightRed, Utilities::Color::Clear);
-	auto [removed_begin, removed_end] = std::ranges::remove_if(bf.battlefield, [](const auto& s) {
+	NARRATE(bf.context.Out(), "{}=============== TURN AFTERMATH ==============={}", Utilities::Color::BrightRed, Utilities::Color::Clear);
+	bf.context.Events().BeginTurn(0);
+	// Compacts the survivors in order. Everyone dead is destroyed; summons
+	// leave their storage in the spawn pool for reuse.
+	size_t kept = 0;
+	for (size_t slot = 0; slot < bf.battlefield.size(); slot++) {
+		auto& s = bf.battlefield[slot];
 		if (s->GetCharacterHealth() <= 0.0) {
 			double taken_damage = s->GetCharacterPreviousHealth() - s->GetCharacterHealth();
-			std::println("{} took {}{:.1f} damage{} and is removed from the battlefield!{}",s->GetNameWithID(), Utilities::Color::Red, taken_damage, Utilities::Color::Clear, Utilities::Color::Clear);
-			return true;
+			s->RecordEvent({ .type = BattleEvent::Type::Removed, .target = s->GetID(), .amount = taken_damage });
+			NARRATE(s->Out(), "{} took {}{:.1f} damage{} and is removed from the battlefield!{}",s->GetNameWithID(), Utilities::Color::Red, taken_damage, Utilities::Color::Clear, Utilities::Color::Clear);
+			bf.spawns.Park(s);
+			s.reset();
+			continue;
 		}
-		return false;
-		});
-	bf.battlefield.erase(removed_begin, removed_end);
+		if (kept != slot) bf.battlefield[kept] = std::move(s);
+		kept++;
+	}
+	if (kept != bf.battlefield.size()) {
+		bf.battlefield.erase(bf.battlefield.begin() + static_cast<std::ptrdiff_t>(kept), bf.battlefield.end());
+		bf.context.Reindex(bf.battlefield);
+	}
 
-	bool player_alive = spectator_mode;
+	// Upkeep runs in three passes. The per-fighter behaviour (RCT, shikigami,
+	// burnout and zone timers) only touches the fighter itself, so it can all
+	// run first, then CE and passive health regen run as one batch over the
+	// battle's FighterStats columns, then the per-fighter reinforcement upkeep
+	// and the aftermath report. Each fighter sees the same steps in the same
+	// order as before, only the narration is grouped by pass.
+	ScratchVector<std::pair<double, double>> before_regen(&bf.context.Scratch());
+	before_regen.reserve(bf.battlefield.size());
 	for (const auto& c : bf.battlefield) {
-		double health_before_regen = c->GetCharacterHealth();
+		before_regen.emplace_back(c->GetCharacterHealth(), 0.0);
+		bf.context.Events().BeginTurn(c->GetID());
 		if (c->IsaCurseUser()) {
 			auto curse_user = static_cast<CurseUser*>(c.get());
-			double ce_before_regen = curse_user->GetCharacterCE();
-			if (auto* tech = curse_user->GetTechnique()) {
-				if (tech->IsLimitless()) {
-					auto lim = static_cast<Limitless*>(tech);
-					lim->InfinityNerf(curse_user);
-				}
+			before_regen.back().second = curse_user->GetCharacterCE();
+			if (curse_user->HasFlag(Character::HasLimitless)) {
+				static_cast<Limitless*>(curse_user->GetTechnique())->InfinityNerf(curse_user);
 			}
 			if (curse_user->IsaSorcerer()) {
 				auto sorcerer = static_cast<Sorcerer*>(curse_user);
@@ -176,58 +187,78 @@ bool BattleManager::ManageEndOfTurn(Battlefield& bf, bool spectator_mode) {
 			curse_user->RecoverBurnout();
 			curse_user->RecoverTechniqueBurnout(curse_user->GetTechnique());
 			curse_user->TickZone();
-			curse_user->RegenCE();
+		}
+	}
+
+	FighterStats& stats = bf.context.Stats();
+	stats.RegenCE();
+	if (bf.context.Events().Listening()) {
+		ScratchVector<double> health(stats.Column(HotStat::Health).begin(), stats.Column(HotStat::Health).end(), &bf.context.Scratch());
+		stats.RegenHealth();
+		std::span<const double> healed = stats.Column(HotStat::Health);
+		for (size_t slot = 0; slot < health.size(); slot++) {
+			if (healed[slot] <= health[slot]) continue;
+			int id = bf.battlefield[slot]->GetID();
+			bf.context.Events().Emit({ .type = BattleEvent::Type::Heal, .source = id, .target = id, .amount = healed[slot] - health[slot] });
+		}
+	}
+	else {
+		stats.RegenHealth();
+	}
+
+	bool player_alive = spectator_mode;
+	for (size_t slot = 0; slot < bf.battlefield.size(); slot++) {
+		const auto& c = bf.battlefield[slot];
+		auto [health_before_regen, ce_before_regen] = before_regen[slot];
+		bf.context.Events().BeginTurn(c->GetID());
+		if (c->IsaCurseUser()) {
+			auto curse_user = static_cast<CurseUser*>(c.get());
 			curse_user->TickReinforcement();
 			double current_ce = curse_user->GetCharacterCE();
 			if (current_ce < ce_before_regen) {
 				double ce_spent = ce_before_regen - current_ce;
-				std::println("{} {}expended{} {:.1f} {}Cursed Energy{} this turn.", c->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, ce_spent, Utilities::Color::Cyan, Utilities::Color::Clear);
+				NARRATE(bf.context.Out(), "{} {}expended{} {:.1f} {}Cursed Energy{} this turn.", c->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, ce_spent, Utilities::Color::Cyan, Utilities::Color::Clear);
 			}
 			else if (current_ce > ce_before_regen) {
 				double ce_gained = current_ce - ce_before_regen;
-				std::println("{} {}gained{} {:.1f} {}Cursed Energy{} this turn.", c->GetNameWithID(),Utilities::Color::Green,Utilities::Color::Clear, ce_gained, Utilities::Color::Cyan, Utilities::Color::Clear);
+				NARRATE(bf.context.Out(), "{} {}gained{} {:.1f} {}Cursed Energy{} this turn.", c->GetNameWithID(),Utilities::Color::Green,Utilities::Color::Clear, ce_gained, Utilities::Color::Cyan, Utilities::Color::Clear);
 			}
-			curse_user->UpdatePreviousCE();
 		}
 		c->TickCharacterSpecialty();
 		double total_damage = c->GetCharacterPreviousHealth() - health_before_regen;
 		double healed_amount = c->GetCharacterHealth() - health_before_regen;
 		if (total_damage > 0) {
-			std::println("{} took {}{:.1f} damage{} this turn", c->GetNameWithID(), Utilities::Color::Red, total_damage, Utilities::Color::Clear);
+			NARRATE(bf.context.Out(), "{} took {}{:.1f} damage{} this turn", c->GetNameWithID(), Utilities::Color::Red, total_damage, Utilities::Color::Clear);
 			if (c->GetCharacterHealth() >= c->GetCharacterPreviousHealth()) {
-				std::println("{} {}healed the damage back!{}", c->GetNameWithID(), Utilities::Color::Green, Utilities::Color::Clear);
+				NARRATE(bf.context.Out(), "{} {}healed the damage back!{}", c->GetNameWithID(), Utilities::Color::Green, Utilities::Color::Clear);
 			}
 			else if (healed_amount > 0) {
-				std::println("{} {}partially healed their wounds.{}", c->GetNameWithID(), Utilities::Color::Yellow, Utilities::Color::Clear);
+				NARRATE(bf.context.Out(), "{} {}partially healed their wounds.{}", c->GetNameWithID(), Utilities::Color::Yellow, Utilities::Color::Clear);
 			}
 		}
 		if (c->IsThePlayer()) {
         	player_alive = true;
     	}
-		c->UpdatePreviousHP();
 		if (c->IsCharacterStunned()){
 			c->ClearStunTime();
 		}
 	}
-	std::println("{}======================================================={}", Utilities::Color::Yellow, Utilities::Color::Clear);
+	stats.SnapshotPrevious();
+	bf.context.Events().BeginTurn(0);
+	NARRATE(bf.context.Out(), "{}======================================================={}", Utilities::Color::Yellow, Utilities::Color::Clear);
 	return player_alive;
 }
 
 void BattleManager::DomainCheckAndPerform(Battlefield& bf) {
-	std::println("\n\n{}================= END OF TURN SUMMARY ================={}", Utilities::Color::Yellow, Utilities::Color::Clear); // this is here now because its just 1 line away from manage end of turn
-	std::println("{}============= DOMAINS AND CLASHES ============{}", Utilities::Color::BrightMagenta, Utilities::Color::Clear);
-	for (const auto& s : bf.battlefield) {
-		if (s->IsaCurseUser()) {
-			auto curse_user = static_cast<CurseUser*>(s.get());
-			if (curse_user->GetDomain() == nullptr) continue;
-			if (curse_user->DomainActive()) {
-				bf.active_domains.push_back(curse_user);
-			}
-		}
-	}
+	NARRATE(bf.context.Out(), "\n\n{}================= END OF TURN SUMMARY ================={}", Utilities::Color::Yellow, Utilities::Color::Clear); // this is here now because its just 1 line away from manage end of turn
+	NARRATE(bf.context.Out(), "{}============= DOMAINS AND CLASHES ============{}", Utilities::Color::BrightMagenta, Utilities::Color::Clear);
+	bf.context.Events().BeginTurn(0);
+	std::span<CurseUser* const> active = bf.context.Index().ActiveDomains();
+	bf.active_domains.reserve(bf.context.Index().CurseUsers().size());
+	bf.active_domains.assign(active.begin(), active.end());
 
 	if (bf.active_domains.size() > 2) {
-		std::println("{}====Its a {}-way domain clash!===={}",Utilities::Color::BrightMagenta, bf.active_domains.size(), Utilities::Color::Clear);
+		NARRATE(bf.context.Out(), "{}====Its a {}-way domain clash!===={}",Utilities::Color::BrightMagenta, bf.active_domains.size(), Utilities::Color::Clear);
 		for (const auto& s : bf.active_domains) {
 			s->GetDomain()->KillSetDomain(*s, *s->GetDomain());
 		}
@@ -249,26 +280,27 @@ void BattleManager::DomainCheckAndPerform(Battlefield& bf) {
 		}
 	}
 
-	for (const auto& s : bf.battlefield) {
-		if (s->IsaCurseUser()) {
-			auto cr = static_cast<CurseUser*>(s.get());
-			if (cr->GetDomain() && cr->DomainActive()){
-				cr->TickDomain();
-				cr->DomainDrain();
-			}
+	// Clashes can collapse domains, so tick whoever from the snapshot is still expanded.
+	for (const auto& cr : bf.active_domains) {
+		if (cr->DomainActive()) {
+			bf.context.Events().BeginTurn(cr->GetID());
+			cr->TickDomain();
+			cr->DomainDrain();
 		}
 	}
 	bf.active_domains.clear();
+	bf.context.Events().BeginTurn(0);
 }
 
 void BattleManager::DoSurehit(CurseUser* crs, Battlefield& bf){
+	bf.context.Events().BeginTurn(crs->GetID());
 	for (const auto& s : bf.battlefield) {
 		if (s.get() == crs) continue;
-		std::println("{} has been caught inside of {}'s {}",
+		NARRATE(bf.context.Out(), "{} has been caught inside of {}'s {}",
 			s->GetNameWithID(),
 			crs->GetNameWithID(),
 			crs->GetDomain()->GetDomainName());
-		crs->GetDomain()->OnSureHit(*crs,*s);
+		crs->GetDomain()->DispatchSureHit(*crs,*s);
 	}
 }
 
@@ -277,30 +309,30 @@ bool BattleManager::IsBattleOver(bool game_over ,bool player_found,bool spectato
 
 	if (bf.battlefield.empty()) {
 		if (spectator_mode) {
-			std::println("Every sorcerer has been wiped off the battlefield!");
+			NARRATE(bf.context.Out(), "Every sorcerer has been wiped off the battlefield!");
 		}
 		else {
-			std::println("You and everyone else has been wiped off the battlefield, it's a draw!");
+			NARRATE(bf.context.Out(), "You and everyone else has been wiped off the battlefield, it's a draw!");
 		}
 		return true;
 	}
 	if (spectator_mode) {
 		if (bf.battlefield.size() == 1) {
-			std::println("The battle has ended, {} is the last one standing!", bf.battlefield[0]->GetNameWithID());
+			NARRATE(bf.context.Out(), "The battle has ended, {} is the last one standing!", bf.battlefield[0]->GetNameWithID());
 		}
 		return true;
 	}
 	if (!player_found) {
 		if (bf.battlefield.size() == 1) {
-			std::println("\nYou have been defeated by {}! Game Over.", bf.battlefield[0]->GetNameWithID());
+			NARRATE(bf.context.Out(), "\nYou have been defeated by {}! Game Over.", bf.battlefield[0]->GetNameWithID());
 		}
 		else {
-			std::println("\nYou have been defeated! The battle rages on without you. Game Over.");
+			NARRATE(bf.context.Out(), "\nYou have been defeated! The battle rages on without you. Game Over.");
 		}
 		return true;
 	}
 	if (player_found && bf.battlefield.size() == 1) {
-		std::println("\nCongratulations! You have defeated all other sorcerers and won the battle!");
+		NARRATE(bf.context.Out(), "\nCongratulations! You have defeated all other sorcerers and won the battle!");
 		return true;
 	}
 	return false;
@@ -0,0 +1,126 @@
+#include "code/header/GameManagement/BattleRandom.h"
+
+namespace {
+	constexpr std::uint32_t philox_m0 = 0xD2511F53u;
+	constexpr std::uint32_t philox_m1 = 0xCD9E8D57u;
+	constexpr std::uint32_t philox_w0 = 0x9E3779B9u;
+	constexpr std::uint32_t philox_w1 = 0xBB67AE85u;
+
+	std::uint64_t RangeOf(int min, int max) {
+		return static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+	}
+	std::uint32_t ThresholdOf(std::uint32_t range) {
+		return static_cast<std::uint32_t>(-range) % range;
+	}
+}
+
+BattleRandom::BattleRandom(std::uint64_t s, std::uint64_t st) : seed(s), stream(st) {}
+
+void BattleRandom::Reseed(std::uint64_t new_seed) {
+	seed = new_seed;
+	block = 0;
+	buffered = 0;
+}
+
+std::uint64_t BattleRandom::GetSeed() const {
+	return seed;
+}
+
+std::uint64_t BattleRandom::GetStream() const {
+	return stream;
+}
+
+BattleRandom BattleRandom::Stream(std::uint64_t id) const {
+	return BattleRandom(seed, id);
+}
+
+std::array<std::uint32_t, 4> BattleRandom::GenerateBlock(std::uint64_t index) const {
+	return Philox(
+		{ static_cast<std::uint32_t>(index), static_cast<std::uint32_t>(index >> 32), static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32) },
+		{ static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32) });
+}
+
+std::array<std::uint32_t, 4> BattleRandom::Philox(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key) {
+	auto [c0, c1, c2, c3] = counter;
+	auto [k0, k1] = key;
+
+	for (int round = 0; round < 10; round++) {
+		const std::uint64_t p0 = static_cast<std::uint64_t>(philox_m0) * c0;
+		const std::uint64_t p1 = static_cast<std::uint64_t>(philox_m1) * c2;
+		const std::uint32_t n0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ k0;
+		const std::uint32_t n2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ k1;
+		c1 = static_cast<std::uint32_t>(p1);
+		c3 = static_cast<std::uint32_t>(p0);
+		c0 = n0;
+		c2 = n2;
+		k0 += philox_w0;
+		k1 += philox_w1;
+	}
+	return { c0, c1, c2, c3 };
+}
+
+std::uint32_t BattleRandom::NextWord() {
+	if (buffered == 0) {
+		buffer = GenerateBlock(block++);
+		buffered = buffer.size();
+	}
+	return buffer[buffer.size() - buffered--];
+}
+
+// Lemire's multiply-shift reduction, exact thanks to the rejection on the low word
+std::uint32_t BattleRandom::NextBelow(std::uint32_t range, std::uint32_t threshold) {
+	std::uint64_t product = static_cast<std::uint64_t>(NextWord()) * range;
+	while (static_cast<std::uint32_t>(product) < threshold) {
+		product = static_cast<std::uint64_t>(NextWord()) * range;
+	}
+	return static_cast<std::uint32_t>(product >> 32);
+}
+
+int BattleRandom::Next(int min, int max) {
+	if (max <= min) return min;
+	const std::uint64_t range = RangeOf(min, max);
+	if (range > std::numeric_limits<std::uint32_t>::max()) {
+		return static_cast<int>(static_cast<std::int64_t>(min) + NextWord());
+	}
+	const auto r = static_cast<std::uint32_t>(range);
+	return static_cast<int>(static_cast<std::int64_t>(min) + NextBelow(r, ThresholdOf(r)));
+}
+
+bool BattleRandom::Chance(int chance, int out_of) {
+	return Next(1, out_of) <= chance;
+}
+
+void BattleRandom::FillBounded(std::span<int> out, int min, int max) {
+	if (max <= min || RangeOf(min, max) > std::numeric_limits<std::uint32_t>::max()) {
+		for (int& v : out) v = Next(min, max);
+		return;
+	}
+	const auto range = static_cast<std::uint32_t>(RangeOf(min, max));
+	const std::uint32_t threshold = ThresholdOf(range);
+	for (int& v : out) {
+		v = static_cast<int>(static_cast<std::int64_t>(min) + NextBelow(range, threshold));
+	}
+}
+
+void BattleRandom::FillBernoulli(std::span<std::uint8_t> out, int chance, int out_of) {
+	if (out_of <= 1) {
+		for (auto& v : out) v = chance >= 1;
+		return;
+	}
+	const auto range = static_cast<std::uint32_t>(out_of);
+	const std::uint32_t threshold = ThresholdOf(range);
+	for (auto& v : out) {
+		v = static_cast<int>(NextBelow(range, threshold)) < chance;
+	}
+}
+
+std::pmr::vector<int> BattleRandom::Batch(size_t count, int min, int max, std::pmr::memory_resource* memory) {
+	std::pmr::vector<int> draws(count, memory);
+	FillBounded(draws, min, max);
+	return draws;
+}
+
+std::uint64_t BattleRandom::RandomSeed() {
+	std::random_device rd;
+	return (static_cast<std::uint64_t>(rd()) << 32) ^ rd();
+}
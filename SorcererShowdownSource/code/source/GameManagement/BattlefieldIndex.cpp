@@ -0,0 +1,112 @@
+#include "code/header/GameManagement/BattlefieldIndex.h"
+#include "code/header/Characters/CurseUsers/CurseUser.h"
+
+bool BattlefieldIndex::Contains(const Character* c) const {
+	int id = c->GetID();
+	return id > 0 && static_cast<size_t>(id) < by_id.size() && by_id[static_cast<size_t>(id)] == c;
+}
+
+void BattlefieldIndex::Add(Character* c, size_t slot) {
+	int id = c->GetID();
+	if (id <= 0) return;
+	size_t index = static_cast<size_t>(id);
+	if (index >= by_id.size()) {
+		by_id.resize(index + 1, nullptr);
+		slot_of.resize(index + 1, -1);
+	}
+	by_id[index] = c;
+	slot_of[index] = static_cast<int>(slot);
+	if (slot >= members.size()) members.resize(slot + 1, nullptr);
+	members[slot] = c;
+	generation++;
+	if (c->GetCharacterHealth() > 0) alive++;
+	if (c->IsThePlayer()) player_id = id;
+	if (c->IsaCurseUser()) {
+		auto* crs = static_cast<CurseUser*>(c);
+		curse_users.push_back(crs);
+		// room for every curse user's domain, so activating one never allocates mid battle
+		active_domains.reserve(curse_users.size());
+		if (crs->DomainActive()) DomainChanged(crs, true);
+	}
+}
+
+void BattlefieldIndex::Rebuild(const std::vector<std::unique_ptr<Character>>& battlefield) {
+	int player = player_id;
+	by_id.clear();
+	slot_of.clear();
+	members.clear();
+	curse_users.clear();
+	active_domains.clear();
+	alive = 0;
+	player_id = 0;
+	for (size_t slot = 0; slot < battlefield.size(); slot++) {
+		Add(battlefield[slot].get(), slot);
+	}
+	if (player > 0 && Find(player)) player_id = player;
+	generation++;
+}
+
+void BattlefieldIndex::HealthChanged(const Character* c, bool now_alive) {
+	if (!Contains(c)) return;
+	alive += now_alive ? 1 : -1;
+}
+
+void BattlefieldIndex::DomainChanged(CurseUser* c, bool now_active) {
+	if (!Contains(c)) return;
+	auto by_id_order = [](const CurseUser* a, const CurseUser* b) { return a->GetID() < b->GetID(); };
+	auto it = std::ranges::lower_bound(active_domains, c, by_id_order);
+	bool listed = it != active_domains.end() && *it == c;
+	if (now_active && !listed) active_domains.insert(it, c);
+	else if (!now_active && listed) active_domains.erase(it);
+}
+
+void BattlefieldIndex::SetPlayer(const Character* c, bool is_player) {
+	if (!Contains(c)) return;
+	if (is_player) player_id = c->GetID();
+	else if (player_id == c->GetID()) player_id = 0;
+}
+
+int BattlefieldIndex::AliveCount() const {
+	return alive;
+}
+
+bool BattlefieldIndex::PlayerAlive() const {
+	const Character* player = Player();
+	return player && player->GetCharacterHealth() > 0;
+}
+
+Character* BattlefieldIndex::Player() const {
+	return Find(player_id);
+}
+
+Character* BattlefieldIndex::Find(int id) const {
+	if (id <= 0 || static_cast<size_t>(id) >= by_id.size()) return nullptr;
+	return by_id[static_cast<size_t>(id)];
+}
+
+int BattlefieldIndex::SlotOf(int id) const {
+	if (id <= 0 || static_cast<size_t>(id) >= slot_of.size()) return -1;
+	return slot_of[static_cast<size_t>(id)];
+}
+
+std::span<Character* const> BattlefieldIndex::Members() const {
+	return members;
+}
+
+unsigned BattlefieldIndex::Generation() const {
+	return generation;
+}
+
+std::span<CurseUser* const> BattlefieldIndex::CurseUsers() const {
+	return curse_users;
+}
+
+std::span<CurseUser* const> BattlefieldIndex::ActiveDomains() const {
+	return active_domains;
+}
+
+int BattlefieldIndex::OtherActiveDomains(const CurseUser* c) const {
+	int count = static_cast<int>(active_domains.size());
+	if (c->DomainActive() && Contains(c)) count--;
+	return count;
+}
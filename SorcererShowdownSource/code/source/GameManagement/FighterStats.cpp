@@ -0,0 +1,59 @@
+#include "code/header/GameManagement/FighterStats.h"
+
+size_t FighterStats::Add(const Values& values) {
+	for (size_t stat = 0; stat < HotStatCount; stat++) {
+		columns[stat].push_back(values[stat]);
+	}
+	return columns[0].size() - 1;
+}
+
+// kept[i] is the old slot of the fighter that now sits at slot i.
+void FighterStats::Compact(std::span<const size_t> kept) {
+	for (auto& column : columns) {
+		for (size_t slot = 0; slot < kept.size(); slot++) {
+			column[slot] = column[kept[slot]];
+		}
+		column.resize(kept.size());
+	}
+}
+
+size_t FighterStats::Size() const {
+	return columns[0].size();
+}
+
+std::span<const double> FighterStats::Column(HotStat stat) const {
+	return columns[static_cast<size_t>(stat)];
+}
+
+// The loops below are written over raw restrict pointers with no early outs
+// so the compiler can turn them into packed min/add/blend instructions.
+
+void FighterStats::RegenCE() {
+	const size_t n = Size();
+	double* __restrict ce = columns[static_cast<size_t>(HotStat::CursedEnergy)].data();
+	const double* __restrict max_ce = columns[static_cast<size_t>(HotStat::MaxCursedEnergy)].data();
+	const double* __restrict regen = columns[static_cast<size_t>(HotStat::CERegen)].data();
+	for (size_t i = 0; i < n; i++) {
+		ce[i] = std::min(ce[i] + regen[i], max_ce[i]);
+	}
+}
+
+void FighterStats::RegenHealth() {
+	const size_t n = Size();
+	double* __restrict health = columns[static_cast<size_t>(HotStat::Health)].data();
+	const double* __restrict max_health = columns[static_cast<size_t>(HotStat::MaxHealth)].data();
+	const double* __restrict passive = columns[static_cast<size_t>(HotStat::PassiveRegen)].data();
+	const double* __restrict regenerates = columns[static_cast<size_t>(HotStat::Regenerates)].data();
+	// Regen clamps to max even at 0 and applies negative regen, so only the mask decides.
+	for (size_t i = 0; i < n; i++) {
+		double healed = std::min(health[i] + passive[i], max_health[i]);
+		health[i] = regenerates[i] != 0.0 ? healed : health[i];
+	}
+}
+
+void FighterStats::SnapshotPrevious() {
+	auto& health = columns[static_cast<size_t>(HotStat::Health)];
+	auto& ce = columns[static_cast<size_t>(HotStat::CursedEnergy)];
+	std::ranges::copy(health, columns[static_cast<size_t>(HotStat::PreviousHealth)].begin());
+	std::ranges::copy(ce, columns[static_cast<size_t>(HotStat::PreviousCE)].begin());
+}
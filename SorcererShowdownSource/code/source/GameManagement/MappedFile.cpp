@@ -0,0 +1,77 @@
+#include "code/header/GameManagement/MappedFile.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// The view outlives the handles it was mapped through, so they are closed
+// as soon as it exists and a roster directory of thousands of files does
+// not hold thousands of descriptors open.
+#ifdef _WIN32
+MappedFile::MappedFile(const std::filesystem::path& path) {
+	HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) return;
+	LARGE_INTEGER length{};
+	if (GetFileSizeEx(file, &length)) {
+		open = true;
+		size = static_cast<size_t>(length.QuadPart);
+	}
+	if (open && size > 0) {
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping) {
+			data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+			CloseHandle(mapping);
+		}
+		if (!data) {
+			open = false;
+			size = 0;
+		}
+	}
+	CloseHandle(file);
+}
+
+MappedFile::~MappedFile() {
+	if (data) UnmapViewOfFile(data);
+}
+#else
+MappedFile::MappedFile(const std::filesystem::path& path) {
+	int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) return;
+	struct stat info {};
+	if (fstat(fd, &info) == 0) {
+		open = true;
+		size = static_cast<size_t>(info.st_size);
+	}
+	if (open && size > 0) {
+		void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapped == MAP_FAILED) {
+			open = false;
+			size = 0;
+		}
+		else {
+			madvise(mapped, size, MADV_SEQUENTIAL);
+			data = static_cast<const char*>(mapped);
+		}
+	}
+	close(fd);
+}
+
+MappedFile::~MappedFile() {
+	if (data) munmap(const_cast<char*>(data), size);
+}
+#endif
+
+bool MappedFile::IsOpen() const {
+	return open;
+}
+
+std::string_view MappedFile::View() const {
+	return { data, size };
+}
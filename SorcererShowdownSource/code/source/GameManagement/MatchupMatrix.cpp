@@ -0,0 +1,247 @@
+#include "code/header/GameManagement/MatchupMatrix.h"
+#include "code/header/GameManagement/BattlefieldHeader.h"
+#include "code/header/Characters/Character.h"
+#include "json.hpp"
+
+namespace {
+	// A full matrix grows with the square of the roster; past this, name the fighters.
+	constexpr size_t max_full_matrix_entries = 256;
+}
+
+void MatchupCell::Add(const BattleResult& result, int row_id, int col_id) {
+	battles++;
+	rounds += result.rounds;
+	if (result.outcome == BattleResult::Outcome::TurnCap) turn_caps++;
+
+	bool won = result.outcome == BattleResult::Outcome::Win;
+	if (won && result.winner_id == row_id) {
+		wins++;
+		win_health += result.winner_health;
+	}
+	else if (won && result.winner_id == col_id) {
+		losses++;
+		loss_health += result.winner_health;
+	}
+	else {
+		draws++;
+	}
+}
+
+void MatchupCell::Merge(const MatchupCell& other) {
+	battles += other.battles;
+	wins += other.wins;
+	draws += other.draws;
+	losses += other.losses;
+	turn_caps += other.turn_caps;
+	rounds += other.rounds;
+	win_health += other.win_health;
+	loss_health += other.loss_health;
+}
+
+MatchupCell MatchupCell::Mirrored() const {
+	MatchupCell mirrored = *this;
+	std::swap(mirrored.wins, mirrored.losses);
+	std::swap(mirrored.win_health, mirrored.loss_health);
+	return mirrored;
+}
+
+double MatchupCell::Rate(int count) const {
+	return battles > 0 ? static_cast<double>(count) / battles : 0.0;
+}
+
+double MatchupCell::MeanRounds() const {
+	return battles > 0 ? static_cast<double>(rounds) / battles : 0.0;
+}
+
+double MatchupCell::MeanWinHealth() const {
+	return wins > 0 ? win_health / wins : 0.0;
+}
+
+// 95% Wilson score interval, which stays inside [0, 1] and behaves at 0 or n wins.
+ConfidenceInterval MatchupMatrix::WilsonInterval(int successes, int trials) {
+	if (trials <= 0) return { 0.0, 1.0 };
+	const double z = 1.96;
+	const double n = trials;
+	const double p = successes / n;
+	const double denom = 1.0 + z * z / n;
+	const double centre = (p + z * z / (2.0 * n)) / denom;
+	const double margin = z * std::sqrt(p * (1.0 - p) / n + z * z / (4.0 * n * n)) / denom;
+	return { std::max(0.0, centre - margin), std::min(1.0, centre + margin) };
+}
+
+int MatchupMatrix::Run(const BatchOptions& options) {
+	BattleCreator bc;
+	BatchRunner::LoadRoster(bc, options);
+
+	if (options.fighters.empty()) {
+		if (bc.characterlist.Size() > max_full_matrix_entries) {
+			std::println(stderr, "The roster has {} entries, a full matrix takes at most {}; pick the fighters with --fighter",
+				bc.characterlist.Size(), max_full_matrix_entries);
+			return 1;
+		}
+		bc.characterlist.BuildAll();
+		for (size_t i = 0; i < bc.characterlist.Size(); i++) entries.push_back(bc.characterlist.At(i));
+	}
+	else {
+		for (const auto& [name, count] : options.fighters) {
+			const Character* entry = bc.characterlist.Build(name);
+			if (!entry) {
+				std::println(stderr, "Unknown fighter \"{}\"", name);
+				return 1;
+			}
+			entries.push_back(entry);
+		}
+	}
+	if (entries.empty()) {
+		std::println(stderr, "The roster is empty");
+		return 1;
+	}
+
+	BatchOptions run_options = options;
+	if (!run_options.seeded) run_options.seed = BattleRandom::RandomSeed();
+
+	const size_t n = entries.size();
+	const size_t pairs = n * (n + 1) / 2;
+	const int threads = BatchRunner::ThreadCount(options, static_cast<std::int64_t>(pairs) * options.battles);
+
+	auto start = std::chrono::steady_clock::now();
+	Play(run_options, threads);
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	std::string text = options.format == "json" ? FormatJson(run_options) : FormatCsv();
+	if (options.output_path.empty()) {
+		std::print("{}", text);
+	}
+	else {
+		std::ofstream file(options.output_path, std::ios::out | std::ios::trunc);
+		if (!file) {
+			std::println(stderr, "Could not open output file \"{}\"", options.output_path);
+			return 1;
+		}
+		file << text;
+	}
+
+	std::println(stderr, "{} matchups x {} battles from seed {} on {} thread(s) in {:.2f}s",
+		pairs, options.battles, run_options.seed, threads, elapsed.count());
+	return 0;
+}
+
+size_t MatchupMatrix::PairIndex(size_t row, size_t col) const {
+	const size_t n = entries.size();
+	return row * n - row * (row - 1) / 2 + (col - row);
+}
+
+MatchupCell MatchupMatrix::Cell(size_t row, size_t col) const {
+	return row <= col ? cells[PairIndex(row, col)] : cells[PairIndex(col, row)].Mirrored();
+}
+
+// Every unordered pair (mirror matches included) gets options.battles battles.
+// Battle k overall uses seed + k, and the fighters swap who acts first on odd
+// battles so turn order does not skew the matrix. Work is handed out as chunks
+// of one pair's battles, split finely enough to keep every thread busy on a
+// small roster. Each chunk has its own cell and the chunks are merged in order,
+// so the totals do not depend on the thread count.
+void MatchupMatrix::Play(const BatchOptions& options, int threads) {
+	const size_t n = entries.size();
+	std::vector<std::pair<size_t, size_t>> pairs;
+	pairs.reserve(n * (n + 1) / 2);
+	for (size_t row = 0; row < n; row++) {
+		for (size_t col = row; col < n; col++) pairs.emplace_back(row, col);
+	}
+
+	const std::int64_t battles = options.battles;
+	const std::int64_t wanted_chunks = static_cast<std::int64_t>(threads) * 4;
+	const std::int64_t chunks_per_pair = std::clamp<std::int64_t>((wanted_chunks + std::ssize(pairs) - 1) / std::ssize(pairs), 1, std::max<std::int64_t>(battles, 1));
+	const std::int64_t chunks = std::ssize(pairs) * chunks_per_pair;
+	std::vector<MatchupCell> partial(static_cast<size_t>(chunks));
+	std::atomic<std::int64_t> next_chunk = 0;
+
+	{
+		std::vector<std::jthread> workers;
+		for (int t = 0; t < threads; t++) {
+			workers.emplace_back([&] {
+				while (true) {
+					std::int64_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed);
+					if (chunk >= chunks) return;
+					const std::int64_t pair = chunk / chunks_per_pair;
+					const std::int64_t part = chunk % chunks_per_pair;
+					auto [row, col] = pairs[static_cast<size_t>(pair)];
+					MatchupCell& cell = partial[static_cast<size_t>(chunk)];
+
+					for (std::int64_t b = part * battles / chunks_per_pair; b < (part + 1) * battles / chunks_per_pair; b++) {
+						const std::int64_t k = pair * battles + b;
+						bool row_first = b % 2 == 0;
+
+						Battlefield bf;
+						bf.context.Reseed(options.seed + static_cast<std::uint64_t>(k));
+						bf.context.Config().turn_cap = options.turn_cap;
+						bf.context.Config().spectator_mode = true;
+						bf.context.SetSink(std::make_unique<NullSink>());
+						BatchRunner::AddFighter(bf, *entries[row_first ? row : col]);
+						BatchRunner::AddFighter(bf, *entries[row_first ? col : row]);
+						BattleResult result = BatchRunner::RunBattle(bf);
+
+						int row_id = row_first ? 1 : 2;
+						cell.Add(result, row_id, 3 - row_id);
+					}
+				}
+			});
+		}
+	}
+
+	cells.assign(pairs.size(), MatchupCell{});
+	for (std::int64_t chunk = 0; chunk < chunks; chunk++) {
+		cells[static_cast<size_t>(chunk / chunks_per_pair)].Merge(partial[static_cast<size_t>(chunk)]);
+	}
+}
+
+std::string MatchupMatrix::FormatCsv() const {
+	std::string out = "row,col,battles,wins,draws,losses,turn_caps,win_rate,win_low,win_high,draw_rate,loss_rate,mean_rounds,mean_win_hp\n";
+	for (size_t row = 0; row < entries.size(); row++) {
+		for (size_t col = 0; col < entries.size(); col++) {
+			const MatchupCell c = Cell(row, col);
+			ConfidenceInterval ci = WilsonInterval(c.wins, c.battles);
+			std::format_to(std::back_inserter(out), "{},{},{},{},{},{},{},{:.4f},{:.4f},{:.4f},{:.4f},{:.4f},{:.2f},{:.1f}\n",
+				entries[row]->GetSimpleName(), entries[col]->GetSimpleName(), c.battles, c.wins, c.draws, c.losses, c.turn_caps,
+				c.Rate(c.wins), ci.low, ci.high, c.Rate(c.draws), c.Rate(c.losses), c.MeanRounds(), c.MeanWinHealth());
+		}
+	}
+	return out;
+}
+
+std::string MatchupMatrix::FormatJson(const BatchOptions& options) const {
+	nlohmann::json root;
+	root["seed"] = options.seed;
+	root["battles_per_pair"] = options.battles;
+	root["turn_cap"] = options.turn_cap;
+	root["confidence"] = 0.95;
+
+	nlohmann::json fighters = nlohmann::json::array();
+	for (const Character* entry : entries) fighters.push_back(entry->GetSimpleName());
+	root["fighters"] = fighters;
+
+	nlohmann::json matrix = nlohmann::json::array();
+	for (size_t row = 0; row < entries.size(); row++) {
+		nlohmann::json line = nlohmann::json::array();
+		for (size_t col = 0; col < entries.size(); col++) {
+			const MatchupCell c = Cell(row, col);
+			ConfidenceInterval ci = WilsonInterval(c.wins, c.battles);
+			line.push_back({
+				{ "battles", c.battles },
+				{ "wins", c.wins },
+				{ "draws", c.draws },
+				{ "losses", c.losses },
+				{ "turn_caps", c.turn_caps },
+				{ "win_rate", c.Rate(c.wins) },
+				{ "win_ci", { ci.low, ci.high } },
+				{ "draw_rate", c.Rate(c.draws) },
+				{ "loss_rate", c.Rate(c.losses) },
+				{ "mean_rounds", c.MeanRounds() },
+				{ "mean_win_hp", c.MeanWinHealth() }
+			});
+		}
+		matrix.push_back(line);
+	}
+	root["matrix"] = matrix;
+	return root.dump(2) + "\n";
+}
@@ -0,0 +1,44 @@
+#include "code/header/GameManagement/OutputSink.h"
+
+bool OutputSink::Enabled() const {
+	return true;
+}
+
+OutputSink& OutputSink::Stdout() {
+	static StdoutSink sink;
+	return sink;
+}
+
+void StdoutSink::Write(std::string_view line) {
+	std::println("{}", line);
+}
+
+FileSink::FileSink(const std::filesystem::path& path) : file(path, std::ios::out | std::ios::trunc) {}
+
+bool FileSink::IsOpen() const {
+	return file.is_open();
+}
+
+void FileSink::Write(std::string_view line) {
+	std::lock_guard lock(file_mutex);
+	file << line << '\n';
+}
+
+void MemorySink::Write(std::string_view line) {
+	buffer.append(line);
+	buffer.push_back('\n');
+}
+
+const std::string& MemorySink::Contents() const {
+	return buffer;
+}
+
+void MemorySink::Clear() {
+	buffer.clear();
+}
+
+bool NullSink::Enabled() const {
+	return false;
+}
+
+void NullSink::Write(std::string_view) {}
@@ -3,12 +3,33 @@
 #include "code/header/GameManagement/BattleManager.h"
 #include "code/header/GameManagement/PlayerManager.h"
 #include "code/header/GameManagement/UserInterface.h"
+#include "code/header/GameManagement/BatchRunner.h"
+#include "code/header/GameManagement/MatchupMatrix.h"
+
+int main(int argc, char* argv[]) {
+	if (BatchRunner::IsBatchRequest(argc, argv)) {
+		BatchOptions options;
+		if (!BatchRunner::ParseArgs(argc, argv, options)) {
+			BatchRunner::PrintUsage();
+			return 1;
+		}
+		if (options.matrix) {
+			MatchupMatrix matrix;
+			return matrix.Run(options);
+		}
+		BatchRunner runner;
+		return runner.Run(options);
+	}
 
-int main() {
 	Battlefield bf; BattleCreator bc; BattleManager manager;
 	PlayerManager player; UserInterface interface;
+	bf.context.Reseed(BattleRandom::RandomSeed());
 
+	// The roster is built outside the arena, since it is rebuilt whenever
+	// setup reloads it and would otherwise pile up in the battle's memory.
 	bool spectator_mode = manager.SetupBattlefield(bf, bc);
+	BattleArena::Scope arena_scope(bf.arena);
+	bf.context.Config().spectator_mode = spectator_mode;
 	auto [skip_turns, skip_all] = manager.SkipTurnFullyCheck();
 	interface.ShowBattleEntry(bf.battlefield);
 	
@@ -17,8 +38,10 @@ int main() {
 	}
 	while (true) {
 		bool game_over = false;
+		bf.context.BeginRound();
 		for (const auto& s : bf.battlefield) {
 			if (s->GetCharacterHealth() <= 0.0) continue;
+			bf.context.BeginTurn(s->GetID());
 			if (s->IsThePlayer()) {
 				interface.DisplaySorcererStatus(s.get());
 				if (s->IsCharacterStunned()) continue;
@@ -0,0 +1,45 @@
+#include "code/header/GameManagement/SpawnPool.h"
+#include "code/header/Characters/Character.h"
+
+// Parked storage goes back through the class operator delete, as it would
+// have if the unit had been deleted (BattleArena::Free).
+SpawnPool::~SpawnPool() {
+	for (const Storage& s : spare) Character::operator delete(s.bytes);
+}
+
+// The caller constructs the new unit in the storage, which is why only exact
+// type matches are handed back.
+void* SpawnPool::Reclaim(const std::type_info& type) {
+	for (auto it = spare.rbegin(); it != spare.rend(); ++it) {
+		if (it->type != type) continue;
+		void* storage = it->bytes;
+		spare.erase(std::next(it).base());
+		return storage;
+	}
+	return nullptr;
+}
+
+void SpawnPool::Queue(Character* unit) {
+	pending.emplace_back(unit);
+}
+
+std::span<std::unique_ptr<Character>> SpawnPool::Pending() {
+	return pending;
+}
+
+void SpawnPool::ClearPending() {
+	pending.clear();
+}
+
+void SpawnPool::Park(std::unique_ptr<Character>& unit) {
+	if (!unit || std::ranges::find(kinds, std::type_index(typeid(*unit))) == kinds.end()) return;
+	Character* body = unit.release();
+	const Storage storage{ dynamic_cast<void*>(body), typeid(*body) };
+	std::destroy_at(body);
+	if (spare.size() < largest_batch) spare.push_back(storage);
+	else Character::operator delete(storage.bytes);
+}
+
+size_t SpawnPool::Spare() const {
+	return spare.size();
+}
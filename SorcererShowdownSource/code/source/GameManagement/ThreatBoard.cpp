@@ -0,0 +1,152 @@
+#include "code/header/GameManagement/ThreatBoard.h"
+#include "code/header/GameManagement/BattlefieldIndex.h"
+#include "code/header/GameManagement/FighterStats.h"
+#include "code/header/Characters/Character.h"
+
+namespace {
+	// The only flags a policy scores on.
+	constexpr std::uint16_t trait_mask = Character::KindCurseUser | Character::KindGifted | Character::KindCursedSpirit
+		| Character::HasLimitless | Character::HasShrine | Character::InfinityOn | Character::DomainOn;
+}
+
+void ThreatBoard::Reseed(BattleRandom stream) {
+	rng = stream;
+	round++;
+	shortlists.clear();
+	shortlists.reserve(max_shortlists);
+}
+
+void ThreatBoard::BeginRound() {
+	round++;
+}
+
+void ThreatBoard::Refresh(const BattlefieldIndex& index, const FighterStats& table) {
+	stats = &table;
+	if (built && generation == index.Generation()) return;
+	std::span<Character* const> members = index.Members();
+	fighters.assign(members.begin(), members.end());
+	traits.resize(members.size());
+	stat_slots.resize(members.size());
+	rolls.resize(members.size());
+	for (size_t row = 0; row < members.size(); row++) {
+		const Character* c = members[row];
+		traits[row] = c ? c->Flags() & trait_mask : 0;
+		stat_slots[row] = c ? static_cast<std::uint32_t>(c->GetStatSlot()) : 0;
+	}
+	generation = index.Generation();
+	built = true;
+	round++;
+}
+
+void ThreatBoard::TraitsChanged(int slot, const Character& c) {
+	if (slot < 0 || static_cast<size_t>(slot) >= fighters.size()) return;
+	size_t row = static_cast<size_t>(slot);
+	if (fighters[row] == &c) traits[row] = c.Flags() & trait_mask;
+}
+
+size_t ThreatBoard::Size() const {
+	return fighters.size();
+}
+
+bool ThreatBoard::Eligible(size_t row, const ThreatPolicy& policy) const {
+	if (!fighters[row]) return false;
+	return !policy.skip_dead || stats->Column(HotStat::Health)[stat_slots[row]] > 0.0;
+}
+
+double ThreatBoard::Score(size_t row, const ThreatPolicy& policy, double self_max) const {
+	const double health = stats->Column(HotStat::Health)[stat_slots[row]];
+	const double max_health = stats->Column(HotStat::MaxHealth)[stat_slots[row]];
+
+	double score = 0.0;
+	switch (policy.health) {
+	case ThreatPolicy::Health::Ratio: score = health / max_health; break;
+	case ThreatPolicy::Health::Missing: score = 1.0 - (health / max_health); break;
+	case ThreatPolicy::Health::AgainstSelf: score = health / self_max; break;
+	}
+
+	const std::uint16_t f = traits[row];
+	if (f & Character::KindCurseUser) {
+		if (f & Character::DomainOn) score += policy.domain;
+		if (f & Character::HasShrine) score += policy.shrine;
+		if (f & Character::HasLimitless) {
+			bool infinity = policy.check_infinity && (f & Character::InfinityOn);
+			score += infinity ? policy.infinity : policy.limitless;
+		}
+	}
+	else if (f & Character::KindGifted) {
+		score += policy.gifted;
+	}
+	else if (f & Character::KindCursedSpirit) {
+		score += policy.spirit;
+	}
+
+	return score + rolls[row] * policy.jitter;
+}
+
+// Keeps the best rows in descending score order; on ties the earlier slot ranks first.
+void ThreatBoard::Build(Shortlist& list) {
+	std::array<double, shortlist_size> scores{};
+	list.count = 0;
+	list.round = round;
+	for (size_t row = 0; row < fighters.size(); row++) {
+		if (!Eligible(row, *list.policy)) continue;
+		const double score = Score(row, *list.policy, list.self_max);
+		if (list.count == shortlist_size && score <= scores[shortlist_size - 1]) continue;
+
+		size_t at = std::min(list.count, shortlist_size - 1);
+		if (list.count < shortlist_size) list.count++;
+		for (; at > 0 && scores[at - 1] < score; at--) {
+			scores[at] = scores[at - 1];
+			list.rows[at] = list.rows[at - 1];
+		}
+		scores[at] = score;
+		list.rows[at] = static_cast<std::uint32_t>(row);
+	}
+}
+
+ThreatBoard::Shortlist* ThreatBoard::ShortlistFor(const ThreatPolicy& policy, double self_max) {
+	Shortlist* stale = nullptr;
+	for (Shortlist& list : shortlists) {
+		if (list.policy == &policy && list.self_max == self_max) {
+			if (list.round != round) Build(list);
+			return &list;
+		}
+		if (!stale && list.round != round) stale = &list;
+	}
+	if (!stale) {
+		if (shortlists.size() == shortlists.capacity()) return nullptr;
+		stale = &shortlists.emplace_back();
+	}
+	stale->policy = &policy;
+	stale->self_max = self_max;
+	Build(*stale);
+	return stale;
+}
+
+Character* ThreatBoard::Pick(const Character* self, const ThreatPolicy& policy) {
+	if (rolled_round != round) {
+		rng.FillBounded(rolls, -5, 5);
+		rolled_round = round;
+	}
+	const double self_max = self->GetCharacterMaxHealth();
+	const Shortlist* list = ShortlistFor(policy, policy.health == ThreatPolicy::Health::AgainstSelf ? self_max : 0.0);
+
+	Character* target = nullptr;
+	double best_score = -1.0;
+	auto consider = [&](size_t row) {
+		if (fighters[row] == self || !Eligible(row, policy)) return;
+		const double score = Score(row, policy, self_max);
+		if (score > best_score) {
+			best_score = score;
+			target = fighters[row];
+		}
+	};
+
+	if (list) {
+		for (size_t i = 0; i < list->count; i++) consider(list->rows[i]);
+		// A list that was never full held every candidate there was.
+		if (target || list->count < shortlist_size) return target;
+	}
+	for (size_t row = 0; row < fighters.size(); row++) consider(row);
+	return target;
+}
@@ -0,0 +1,51 @@
+#include "code/header/GameManagement/TurnScratch.h"
+
+TurnScratch::TurnScratch(size_t initial_capacity)
+	: buffer(std::make_unique<std::byte[]>(initial_capacity)), capacity(initial_capacity) {}
+
+TurnScratch::~TurnScratch() {
+	ReleaseOverflow();
+}
+
+void TurnScratch::ReleaseOverflow() {
+	for (const Spill& spill : overflow) ::operator delete(spill.block, spill.bytes, std::align_val_t(spill.alignment));
+	overflow.clear();
+}
+
+void* TurnScratch::do_allocate(size_t bytes, size_t alignment) {
+	size_t offset = (used + alignment - 1) & ~(alignment - 1);
+	if (offset + bytes <= capacity) {
+		used = offset + bytes;
+		return buffer.get() + offset;
+	}
+	overflow_bytes += bytes + alignment;
+	if (overflow.empty()) overflows++;
+	void* block = ::operator new(bytes, std::align_val_t(alignment));
+	overflow.push_back({ block, bytes, alignment });
+	return block;
+}
+
+// Freed all at once by Reset.
+void TurnScratch::do_deallocate(void*, size_t, size_t) {}
+
+bool TurnScratch::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+	return this == &other;
+}
+
+void TurnScratch::Reset() {
+	if (!overflow.empty()) {
+		ReleaseOverflow();
+		capacity = std::bit_ceil(capacity + overflow_bytes);
+		buffer = std::make_unique<std::byte[]>(capacity);
+	}
+	overflow_bytes = 0;
+	used = 0;
+}
+
+size_t TurnScratch::Capacity() const {
+	return capacity;
+}
+
+size_t TurnScratch::Overflows() const {
+	return overflows;
+}
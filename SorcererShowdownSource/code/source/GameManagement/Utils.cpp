@@ -21,12 +21,6 @@ namespace Utilities{
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         return ch;
     }
-    int GetRandomNumber(int min, int max) {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_int_distribution<> dis(min, max);
-        return dis(gen);
-    }
     void WaitForInput() {
         std::cin.clear();
         std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
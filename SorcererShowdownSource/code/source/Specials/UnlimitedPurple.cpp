@@ -13,7 +13,7 @@ UnlimitedPurple::UnlimitedPurple() {
 }
 
 void UnlimitedPurple::PerformSpecial(CurseUser* user) {
-	if (!user->GetTechnique() || !user->GetTechnique()->IsLimitless()) return; 
+	if (!user->HasFlag(Character::HasLimitless)) return; 
 
 	auto limitless = static_cast<Limitless*>(user->GetTechnique());
 	if (limitless->UnlimitedHollowAllowed()) return;
@@ -23,12 +23,12 @@ void UnlimitedPurple::PerformSpecial(CurseUser* user) {
 		limitless->UPPurpleCheck()) 
 	{
 		if (!limitless->UnlimitedHollowAllowed()) {
-			std::println("\n{}=== UNLIMITED HOLLOW PURPLE IS NOW POSSIBLE! ==={}",Utilities::Color::Purple,Utilities::Color::Clear);
+			NARRATE(user->Out(), "\n{}=== UNLIMITED HOLLOW PURPLE IS NOW POSSIBLE! ==={}",Utilities::Color::Purple,Utilities::Color::Clear);
 			limitless->SetUnlimitedHollow(true);
 		}
 	}
 	else {
-		std::println("\n{}Unlimited Hollow Purple fails to manifest, the limitless needs to be used more!{}",Utilities::Color::DimGray,Utilities::Color::Clear);
+		NARRATE(user->Out(), "\n{}Unlimited Hollow Purple fails to manifest, the limitless needs to be used more!{}",Utilities::Color::DimGray,Utilities::Color::Clear);
 	}
 	
 }
@@ -11,7 +11,7 @@ WorldCuttingSlash::WorldCuttingSlash() {
 }
 
 void WorldCuttingSlash::PerformSpecial(CurseUser* user) {
-	if (!user->GetTechnique() || !user->GetTechnique()->IsShrine()) return;
+	if (!user->HasFlag(Character::HasShrine)) return;
 
 	auto shrine = static_cast<Shrine*>(user->GetTechnique());
 	if (shrine->WorldCuttingSlashUnlocked()) return;
@@ -22,16 +22,16 @@ void WorldCuttingSlash::PerformSpecial(CurseUser* user) {
 			auto m = static_cast<Mahoraga*>(s.get());
 			if (m->FullyAdapted()) {
 				shrine->SetWCS(true);
-				std::println("The blueprint is complete. The World Cutting Slash can be used!");
+				NARRATE(user->Out(), "The blueprint is complete. The World Cutting Slash can be used!");
 				return;
 			}
 			else {
-				std::println("The blueprint is incomplete. The World Cutting Slash cannot be used yet.");
+				NARRATE(user->Out(), "The blueprint is incomplete. The World Cutting Slash cannot be used yet.");
 				return;
 			}
 		}
 	}
-	std::println("The World Cutting Slash cannot be unlocked, a core piece is missing!");
+	NARRATE(user->Out(), "The World Cutting Slash cannot be unlocked, a core piece is missing!");
 }
 
 std::unique_ptr<Specials> WorldCuttingSlash::Clone() const {
@@ -7,8 +7,10 @@
 
 
 Copy::Copy() {
+    kind = Kind::Copy;
     name = "Copy";
     color = "\033[95m";
+    copied_techniques.reserve(max_copies);
 }
 
 std::unique_ptr<Technique> Copy::Clone() const {
@@ -32,36 +34,36 @@ void Copy::Set(Status s) {
 
 void Copy::CopyFrom(CurseUser* user, CurseUser* target) {
     if (!target || !target->GetTechnique()) {
-        std::println("Nothing to copy!");
+        NARRATE(user->Out(), "Nothing to copy!");
         return;
     }
     if (target->IsPhysicallyGifted()) {
-        std::println("{} has no cursed technique to copy!", target->GetName());
+        NARRATE(user->Out(), "{} has no cursed technique to copy!", target->GetName());
         return;
     }
     if (copied_techniques.size() >= max_copies) {
-        std::println("Copy limit reached ({})!", max_copies);
+        NARRATE(user->Out(), "Copy limit reached ({})!", max_copies);
         return;
     }
     if (target->GetTechnique()->IsCopy()) {
-        std::println("Cannot copy from another Copy user!");
+        NARRATE(user->Out(), "Cannot copy from another Copy user!");
         return;
     }
     if (user->GetCharacterCE() < 500.0) {
-        std::println("Not enough cursed energy to copy!");
+        NARRATE(user->Out(), "Not enough cursed energy to copy!");
         return;
     }
-    std::string ttname = target->GetTechnique()->GetTechniqueName();
+    const Technique& target_tech = *target->GetTechnique();
     for (const auto& tech : copied_techniques) {
-        if (tech->GetTechniqueName() == ttname) {
-            std::println("You have already copied this technique!");
+        if (tech->SameTechniqueAs(target_tech)) {
+            NARRATE(user->Out(), "You have already copied this technique!");
             return;
         }
     }
     auto cloned = target->GetTechnique()->Clone();
     cloned->Set(this->state);
     user->SpendCE(500.0);
-    std::println("Copied {}'s {}!", target->GetName(), cloned->GetTechniqueName());
+    NARRATE(user->Out(), "Copied {}'s {}!", target->GetName(), cloned->GetTechniqueName());
     copied_techniques.push_back(std::move(cloned));
     if (!copied_techniques.empty()) {
         active_copy = copied_techniques.size() - 1; 
@@ -83,9 +85,9 @@ Technique* Copy::GetActive() const {
     return copied_techniques[active_copy].get();
 }
 
-void Copy::Chant() {
-    if (Technique* t = GetActive()) t->Chant();
-    else std::println("No technique active to chant for!");
+void Copy::Chant(CurseUser* user) {
+    if (Technique* t = GetActive()) t->Chant(user);
+    else NARRATE(user->Out(), "No technique active to chant for!");
 }
 
 void Copy::TechniqueMenu(CurseUser* user, Character* target, Battlefield& bf) {
@@ -167,10 +169,12 @@ bool Copy::AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf)
         {
             dont_copy = true;
         }
-        std::string ttname = crs->GetTechnique()->GetTechniqueName();
-        for (const auto& tech : copied_techniques) {
-            if (tech->GetTechniqueName() == ttname) {
-                dont_copy = true;
+        if (!dont_copy) {
+            const Technique& target_tech = *crs->GetTechnique();
+            for (const auto& tech : copied_techniques) {
+                if (tech->SameTechniqueAs(target_tech)) {
+                    dont_copy = true;
+                }
             }
         }
         if (!dont_copy) {
@@ -179,7 +183,7 @@ bool Copy::AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf)
     }
     Technique* active = GetActive();
     if (active) {
-        return this->GetActive()->AutoTechniqueUse(user, target, bf);
+        return active->DispatchAutoUse(user, target, bf);
     }
     return false;
 }
@@ -8,27 +8,37 @@
 
 
 IdleTransfiguration::IdleTransfiguration() {
+    kind = Kind::IdleTransfiguration;
     name = "Idle Transfiguration";
     color = "\033[35m";
 }
 
+bool IdleTransfiguration::Tune(std::string_view key, double value) {
+    if (key != "transfiguration_damage") return false;
+    transfiguration_damage = value;
+    return true;
+}
+
 void IdleTransfiguration::UseTransfiguration(CurseUser* user, Character* target) {
-    std::println("{} tried to transfigure {}!", user->GetNameWithID(), target->GetNameWithID());
+    NARRATE(user->Out(), "{} tried to transfigure {}!", user->GetNameWithID(), target->GetNameWithID());
     double dmg = CalculateDamage(user, transfiguration_damage);
     target->DamageBypassReinforcement(dmg);
     if (target->GetCharacterHealth() <= 0.0) {
         transfigured_human_count++;
-        std::println("{} has gained a transfigured human body", user->GetNameWithID());
+        NARRATE(user->Out(), "{} has gained a transfigured human body", user->GetNameWithID());
     }
     chant = ChantLevel::Zero;
 }
 
-void IdleTransfiguration::SummonTransfiguredHumans(Battlefield& bf) {
-    if (transfigured_human_count > 0) {
-        bf.spawn_queue.push_back(std::make_unique<TransfiguredHuman>());
-        transfigured_human_count--;
+// Summons up to count humans from stock in one batch and returns how many came out.
+int IdleTransfiguration::SummonTransfiguredHumans(Battlefield& bf, int count) {
+    int summoned = std::clamp(count, 0, transfigured_human_count);
+    bf.spawns.SpawnBatch<TransfiguredHuman>(summoned, bf.context.Random());
+    transfigured_human_count -= summoned;
+    for (int i = 0; i < summoned; i++) {
+        NARRATE(bf.context.Out(), "a Transfigured human has been put into the battlefield!");
     }
-    std::println("a Transfigured human has been put into the battlefield!");
+    return summoned;
 }
 
 void IdleTransfiguration::TechniqueMenu(CurseUser* user, Character* target, Battlefield& bf) {
@@ -62,12 +72,7 @@ void IdleTransfiguration::GetTransfiguredSummonAmount(Battlefield& bf) {
     std::println("You currently have {} Transfigured Humans in stock", transfigured_human_count);
     std::println("How much would you like to use\n=> ");
     int ch = Utilities::GetValidInput();
-    int pr = 0;
-
-    while (pr < ch && this->GetTFcount() > 0) {
-        SummonTransfiguredHumans(bf);
-        pr++;
-    }
+    int pr = SummonTransfiguredHumans(bf, ch);
     std::println("You have summoned {} Transfigured Humans!", pr);
 }
 
@@ -75,7 +80,7 @@ int IdleTransfiguration::GetTFcount() const {
     return transfigured_human_count;
 }
 
-void IdleTransfiguration::Chant() {}
+void IdleTransfiguration::Chant(CurseUser*) {}
 
 void IdleTransfiguration::TechniqueSetting(CurseUser*, Battlefield&) {
     std::println("===== Idle Transfiguration Menu =====");
@@ -89,9 +94,7 @@ std::unique_ptr<Technique> IdleTransfiguration::Clone() const {
 
 bool IdleTransfiguration::AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf) {
     if (transfigured_human_count > 3) {
-        while(transfigured_human_count > 0){
-            SummonTransfiguredHumans(bf);
-        }
+        SummonTransfiguredHumans(bf, transfigured_human_count);
         return true;
     }
     UseTransfiguration(user, target);
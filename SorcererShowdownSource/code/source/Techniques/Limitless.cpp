@@ -9,13 +9,23 @@
 
 
 Limitless::Limitless() {
+    kind = Kind::Limitless;
     name = "Limitless";
     color = "\033[36m";
 }
 
+bool Limitless::Tune(std::string_view key, double value) {
+    if (key == "blue_output") blue_output = value;
+    else if (key == "red_output") red_output = value;
+    else if (key == "purple_output") purple_output = value;
+    else if (key == "unlimited_purple_output") unlpurple_output = value;
+    else return false;
+    return true;
+}
+
 void Limitless::UseBlue(CurseUser* user, Character* target) {
-    if (chant == ChantLevel::Four) std::println("{}\"MAXIMUM OUTPUT: BLUE!\"{}", Utilities::Color::Blue, Utilities::Color::Clear);
-    println("{} uses {}Blue{} on {}!", user->GetNameWithID(),Utilities::Color::Blue,Utilities::Color::Clear, target->GetNameWithID());
+    if (chant == ChantLevel::Four) NARRATE(user->Out(), "{}\"MAXIMUM OUTPUT: BLUE!\"{}", Utilities::Color::Blue, Utilities::Color::Clear);
+    NARRATE(user->Out(), "{} uses {}Blue{} on {}!", user->GetNameWithID(),Utilities::Color::Blue,Utilities::Color::Clear, target->GetNameWithID());
     double dmg = CalculateDamage(user, blue_output * GetChantPower());
     target->Damage(dmg);
     blue_used_amount++;
@@ -23,8 +33,8 @@ void Limitless::UseBlue(CurseUser* user, Character* target) {
 }
 
 void Limitless::UseRed(CurseUser* user, Character* target) {
-    if (chant == ChantLevel::Four) std::println("{}\"MAXIMUM OUTPUT: RED!\"{}", Utilities::Color::Red, Utilities::Color::Clear);
-    println("{} uses {}Red{} on {}!", user->GetNameWithID(), Utilities::Color::Red, Utilities::Color::Clear, target->GetNameWithID());
+    if (chant == ChantLevel::Four) NARRATE(user->Out(), "{}\"MAXIMUM OUTPUT: RED!\"{}", Utilities::Color::Red, Utilities::Color::Clear);
+    NARRATE(user->Out(), "{} uses {}Red{} on {}!", user->GetNameWithID(), Utilities::Color::Red, Utilities::Color::Clear, target->GetNameWithID());
     double dmg = CalculateDamage(user, red_output * GetChantPower());
     target->Damage(dmg);
     red_used_amount++;
@@ -32,8 +42,8 @@ void Limitless::UseRed(CurseUser* user, Character* target) {
 }
 
 void Limitless::UsePurple(CurseUser* user, Character* target) {
-    if (chant == ChantLevel::Four) std::println("{}\"HOLLOW PURPLE!\"{}", Utilities::Color::Purple, Utilities::Color::Clear);
-    println("{} hits {} with a {}Hollow Purple!{}", user->GetNameWithID(), target->GetNameWithID(), Utilities::Color::Purple, Utilities::Color::Clear);
+    if (chant == ChantLevel::Four) NARRATE(user->Out(), "{}\"HOLLOW PURPLE!\"{}", Utilities::Color::Purple, Utilities::Color::Clear);
+    NARRATE(user->Out(), "{} hits {} with a {}Hollow Purple!{}", user->GetNameWithID(), target->GetNameWithID(), Utilities::Color::Purple, Utilities::Color::Clear);
     double dmg = CalculateDamage(user, purple_output * GetChantPower());
     target->Damage(dmg);
     purple_used_amount++;
@@ -48,8 +58,9 @@ bool Limitless::UnlimitedHollowAllowed() const {
     return unlimited_hollow_purple_allowed;
 }
 
-void Limitless::SetInfinity(bool s) {
+void Limitless::SetInfinity(CurseUser* user, bool s) {
     Infinity = s;
+    user->SyncTechniqueFlags();
 }
 
 bool Limitless::CheckInfinity() const {
@@ -68,25 +79,25 @@ bool Limitless::UPPurpleCheck() const {
 
 void Limitless::UseUnlimitedHollowPurple(CurseUser* user, Battlefield& bf) {
     if (up_used) {
-        std::println("Unlimited hollow purple cannot be used again");
+        NARRATE(user->Out(), "Unlimited hollow purple cannot be used again");
         return;
     }
-    std::println("{}===== !UNLIMITED HOLLOW PURPLE! ====={}", Utilities::Color::Purple, Utilities::Color::Clear);
+    NARRATE(user->Out(), "{}===== !UNLIMITED HOLLOW PURPLE! ====={}", Utilities::Color::Purple, Utilities::Color::Clear);
     for (const auto& s : bf.battlefield) {
         if (s.get() == user) {
             s->DamageBypass(unlpurple_output * 0.15);
             double ren = user->GetDamageReinforcement();
             if (s->GetCharacterHealth() <= 0.0) {
-                std::println("The {}Unlimited Hollow Purple{} was too strong for {} himself",Utilities::Color::Purple,Utilities::Color::Clear ,s->GetNameWithID());
+                NARRATE(user->Out(), "The {}Unlimited Hollow Purple{} was too strong for {} himself",Utilities::Color::Purple,Utilities::Color::Clear ,s->GetNameWithID());
             }
             else {
-                std::println("{} took the hit and received{} {:.1f} damage!{}",s->GetNameWithID(), Utilities::Color::Red, (unlpurple_output * 0.15) / ren, Utilities::Color::Clear);
+                NARRATE(user->Out(), "{} took the hit and received{} {:.1f} damage!{}",s->GetNameWithID(), Utilities::Color::Red, (unlpurple_output * 0.15) / ren, Utilities::Color::Clear);
             }
             continue;
         }
         s->DamageBypass(unlpurple_output);
         double ren = s->GetDamageReinforcement();
-        std::println("{} got hit by Unlimited Hollow Purple for {}{:.1f} damage!{}", s->GetNameWithID(), Utilities::Color::Red, unlpurple_output / ren, Utilities::Color::Clear);
+        NARRATE(user->Out(), "{} got hit by Unlimited Hollow Purple for {}{:.1f} damage!{}", s->GetNameWithID(), Utilities::Color::Red, unlpurple_output / ren, Utilities::Color::Clear);
     }
     up_used = true;
     chant = ChantLevel::Zero;
@@ -95,8 +106,8 @@ void Limitless::UseUnlimitedHollowPurple(CurseUser* user, Battlefield& bf) {
 void Limitless::InfinityNerf(CurseUser* user) {
     if (this->BurntOut()) {
         if (CheckInfinity()) {
-            std::println("{}{}'s Infinity shatters due to technique burnout!{}",Utilities::Color::Cyan, user->GetNameWithID(), Utilities::Color::Clear);
-            SetInfinity(false);
+            NARRATE(user->Out(), "{}{}'s Infinity shatters due to technique burnout!{}",Utilities::Color::Cyan, user->GetNameWithID(), Utilities::Color::Clear);
+            SetInfinity(user, false);
         }
         return;
     }
@@ -109,8 +120,8 @@ void Limitless::InfinityNerf(CurseUser* user) {
             }
         }
         if (user->GetCharacterCE() < maintain_cost) {
-            std::println("{}{}'s concentration wavers due to low CE!{}{} Infinity is deactivated.{}",Utilities::Color::Red,user->GetNameWithID(),Utilities::Color::Clear,Utilities::Color::Cyan,Utilities::Color::Clear);
-            SetInfinity(false);
+            NARRATE(user->Out(), "{}{}'s concentration wavers due to low CE!{}{} Infinity is deactivated.{}",Utilities::Color::Red,user->GetNameWithID(),Utilities::Color::Clear,Utilities::Color::Cyan,Utilities::Color::Clear);
+            SetInfinity(user, false);
         }
         else {
             user->SpendCEdirect(maintain_cost);
@@ -194,7 +205,7 @@ void Limitless::TechniqueSetting(CurseUser* user, Battlefield&) {
             std::println("Infinity is already active");
             return;
         }
-        this->SetInfinity(true);
+        this->SetInfinity(user, true);
         std::println("\nInfinity has been Activated");
         break;
     case 2:
@@ -202,11 +213,11 @@ void Limitless::TechniqueSetting(CurseUser* user, Battlefield&) {
             std::println("Infinity is already Disabled");
             return;
         }
-        this->SetInfinity(false);
+        this->SetInfinity(user, false);
         std::println("\nInfinity has been Deactivated");
         break;
     case 3:
-        this->Chant();
+        this->Chant(user);
         break;
     case 4:
         break;
@@ -217,29 +228,29 @@ void Limitless::TechniqueSetting(CurseUser* user, Battlefield&) {
 
 }
 
-void Limitless::Chant() {
+void Limitless::Chant(CurseUser* user) {
     if (chant == ChantLevel::Zero) {
-        std::println("\"{}Phase. Twilight.{}\"",Utilities::Color::Cyan,Utilities::Color::Clear);
+        NARRATE(user->Out(), "\"{}Phase. Twilight.{}\"",Utilities::Color::Cyan,Utilities::Color::Clear);
         chant = ChantLevel::One;
         return;
     }
     else if (chant == ChantLevel::One) {
-        std::println("\"{}Paramita. Pillars of Light.{}\"",Utilities::Color::Blue,Utilities::Color::Clear);
+        NARRATE(user->Out(), "\"{}Paramita. Pillars of Light.{}\"",Utilities::Color::Blue,Utilities::Color::Clear);
         chant = ChantLevel::Two;
         return;
     }
     else if (chant == ChantLevel::Two) {
-        std::println("\"{}Nine ropes. Polarized light. Crow and Shomyo.{}\"",Utilities::Color::BrightRed,Utilities::Color::Clear);
+        NARRATE(user->Out(), "\"{}Nine ropes. Polarized light. Crow and Shomyo.{}\"",Utilities::Color::BrightRed,Utilities::Color::Clear);
         chant = ChantLevel::Three;
         return;
     }
     else if (chant == ChantLevel::Three) {
-        std::println("\"{}The gap between within and without.{}\"",Utilities::Color::BrightMagenta,Utilities::Color::Clear);
+        NARRATE(user->Out(), "\"{}The gap between within and without.{}\"",Utilities::Color::BrightMagenta,Utilities::Color::Clear);
         chant = ChantLevel::Four;
         return;
     }
     else {
-        std::println("Its time to use your Technique, its not gonna get anymore stronger");
+        NARRATE(user->Out(), "Its time to use your Technique, its not gonna get anymore stronger");
     }
 }
 
@@ -252,7 +263,7 @@ bool Limitless::UnlimitedHollowUsed()const {
 }
 
 bool Limitless::AutoTechniqueUse(CurseUser* user, Character* target, Battlefield& bf) {
-    if (Utilities::GetRandomNumber(1, 30) >= 20) {
+    if (user->GetRandom().Next(1, 30) >= 20) {
         UsePurple(user, target);
         return true;
     }
@@ -262,12 +273,12 @@ bool Limitless::AutoTechniqueUse(CurseUser* user, Character* target, Battlefield
             return true;
         }
     }
-    if (Utilities::GetRandomNumber(1, 50) >= 33 || (unlimited_hollow_purple_allowed && !this->FullyChanted() && !up_used)) {
-        Chant();
+    if (user->GetRandom().Next(1, 50) >= 33 || (unlimited_hollow_purple_allowed && !this->FullyChanted() && !up_used)) {
+        Chant(user);
         return true;
     }
     else {
-        if (Utilities::GetRandomNumber(0, 1) == 1) {
+        if (user->GetRandom().Next(0, 1) == 1) {
             UseRed(user, target);
             return true;
         }
@@ -5,10 +5,22 @@
 #include "code/header/GameManagement/Utils.h"
 
 PrivatePureLoveTrain::PrivatePureLoveTrain() {
+	kind = Kind::PrivatePureLoveTrain;
 	name = "Private Pure Love Train";
 	color = "\033[92m";
 }
 
+bool PrivatePureLoveTrain::Tune(std::string_view key, double value) {
+	if (key == "golden_shutter_damage") GOLDEN_SHUTTER_DAMAGE = value;
+	else if (key == "red_shutter_damage") RED_SHUTTER_DAMAGE = value;
+	else if (key == "green_shutter_damage") GREEN_SHUTTER_DAMAGE = value;
+	else if (key == "golden_plinko_damage") GOLDEN_PLINKO_DAMAGE = value;
+	else if (key == "red_plinko_damage") RED_PLINKO_DAMAGE = value;
+	else if (key == "green_plinko_damage") GREEN_PLINKO_DAMAGE = value;
+	else return false;
+	return true;
+}
+
 bool PrivatePureLoveTrain::PlinkoUsed() const {
 	return plinko_used;
 }
@@ -27,41 +39,41 @@ void PrivatePureLoveTrain::TickPlinkoCooldown() {
 
 void PrivatePureLoveTrain::UsePlinkoBalls(CurseUser* user, Character* target) {
 	if (plinko_used) return;
-	int pplt = Utilities::GetRandomNumber(1, 239);
+	int pplt = user->GetRandom().Next(1, 239);
 	if (pplt >= 200) {
 		target->Damage(GOLDEN_PLINKO_DAMAGE);
-		std::println("{} stuns {} with a Golden Plinko ball!", user->GetNameWithID(), target->GetNameWithID());
+		NARRATE(user->Out(), "{} stuns {} with a Golden Plinko ball!", user->GetNameWithID(), target->GetNameWithID());
 	}
 	else if (pplt >= 100) {
 		target->Damage(GREEN_PLINKO_DAMAGE);
-		std::println("{} stuns {} with a Green Plinko ball!", user->GetNameWithID(), target->GetNameWithID());
+		NARRATE(user->Out(), "{} stuns {} with a Green Plinko ball!", user->GetNameWithID(), target->GetNameWithID());
 	}
 	else {
 		target->Damage(RED_PLINKO_DAMAGE);
-		std::println("{} stuns {} with a Red Plinko ball!", user->GetNameWithID(), target->GetNameWithID());
+		NARRATE(user->Out(), "{} stuns {} with a Red Plinko ball!", user->GetNameWithID(), target->GetNameWithID());
 	}
 	plinko_used = true;
 	target->SetStunState(true);
 }
 void PrivatePureLoveTrain::UseShutterDoors(CurseUser* user, Character* target) {
-	int pplt = Utilities::GetRandomNumber(1, 239);
+	int pplt = user->GetRandom().Next(1, 239);
 	if (pplt >= 200) {
 		target->Damage(GOLDEN_SHUTTER_DAMAGE);
-		std::println("{} hits {} with a Golden Shutter!", user->GetNameWithID(), target->GetNameWithID());
+		NARRATE(user->Out(), "{} hits {} with a Golden Shutter!", user->GetNameWithID(), target->GetNameWithID());
 	}
 	else if (pplt >= 100) {
 		target->Damage(GREEN_SHUTTER_DAMAGE);
-		std::println("{} hits {} with a Green Shutter!", user->GetNameWithID(), target->GetNameWithID());
+		NARRATE(user->Out(), "{} hits {} with a Green Shutter!", user->GetNameWithID(), target->GetNameWithID());
 	}
 	else {
 		target->Damage(RED_SHUTTER_DAMAGE);
-		std::println("{} hits {} with a Red Shutter!", user->GetNameWithID(), target->GetNameWithID());
+		NARRATE(user->Out(), "{} hits {} with a Red Shutter!", user->GetNameWithID(), target->GetNameWithID());
 	}
 }
 void PrivatePureLoveTrain::UseJackpotRush(CurseUser* user, Character* target) {
-	double randomized_boost = Utilities::GetRandomNumber(5, 10) / 2.0;
+	double randomized_boost = user->GetRandom().Next(5, 10) / 2.0;
 	target->Damage(user->GetBaseAttackDamage() * randomized_boost);
-	std::println("{} hits {} with a volley of jackpot boosted rush attacks!", user->GetNameWithID(), target->GetNameWithID());
+	NARRATE(user->Out(), "{} hits {} with a volley of jackpot boosted rush attacks!", user->GetNameWithID(), target->GetNameWithID());
 }
 
 void PrivatePureLoveTrain::TechniqueMenu(CurseUser* user, Character* target, Battlefield&) {
@@ -70,7 +82,7 @@ void PrivatePureLoveTrain::TechniqueMenu(CurseUser* user, Character* target, Bat
 		return;
 	}
 	auto domain = user->GetDomain();
-	if (domain && domain->IsIdleDeathGamble()) {
+	if (user->HasFlag(Character::HasIdleDeathGamble)) {
 		auto idg = static_cast<IdleDeathGamble*>(domain);
 		if (idg->HasHitJackpot()) {
 			std::println("1 - Use Plinko balls | 2 - Use Shutter doors || 3 - {}Jackpot Rush{}", Utilities::Color::Green, Utilities::Color::Clear);
@@ -93,7 +105,7 @@ void PrivatePureLoveTrain::TechniqueMenu(CurseUser* user, Character* target, Bat
 		UseShutterDoors(user, target);
 		break;
 	case 3:
-		if (domain && domain->IsIdleDeathGamble()) {
+		if (user->HasFlag(Character::HasIdleDeathGamble)) {
 			auto idg = static_cast<IdleDeathGamble*>(domain);
 			if (!idg->HasHitJackpot()) {
 				std::println("You arent able to use this");
@@ -115,11 +127,11 @@ std::unique_ptr<Technique> PrivatePureLoveTrain::Clone() const {
 }
 
 bool PrivatePureLoveTrain::AutoTechniqueUse(CurseUser* user, Character* target, Battlefield&) {
-	if (Utilities::GetRandomNumber(1, 30) <= 25 && !plinko_used) {
+	if (user->GetRandom().Next(1, 30) <= 25 && !plinko_used) {
 		UsePlinkoBalls(user, target);
 		return true;
 	}
-	if (user->GetDomain() && user->GetDomain()->IsIdleDeathGamble()) {
+	if (user->HasFlag(Character::HasIdleDeathGamble)) {
 		auto idg = static_cast<IdleDeathGamble*>(user->GetDomain());
 		if (idg->HasHitJackpot()) {
 			UseJackpotRush(user, target);
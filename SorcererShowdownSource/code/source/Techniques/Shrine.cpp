@@ -6,34 +6,43 @@
 
 
 Shrine::Shrine() {
+    kind = Kind::Shrine;
     name = "Shrine";
     color = "\033[31m";
 }
 
+bool Shrine::Tune(std::string_view key, double value) {
+    if (key == "slash_output") slash_output = value;
+    else if (key == "cleave_output") cleave_output = value;
+    else if (key == "world_cutting_slash_output") wcs_output = value;
+    else return false;
+    return true;
+}
+
 void Shrine::SetWCS(bool s) {
     world_cutting_slash_allowed = s;
 }
 
 void Shrine::UseCleave(CurseUser* user, Character* target) {
-    if (chant == ChantLevel::Four) std::println("{}\"Maximum Output; ClEAVE!\"{}", Utilities::Color::Red, Utilities::Color::Clear);
-    println("{} uses {}Cleave{} on {}!", user->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, target->GetNameWithID());
+    if (chant == ChantLevel::Four) NARRATE(user->Out(), "{}\"Maximum Output; ClEAVE!\"{}", Utilities::Color::Red, Utilities::Color::Clear);
+    NARRATE(user->Out(), "{} uses {}Cleave{} on {}!", user->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, target->GetNameWithID());
     double dmg = CalculateDamage(user, cleave_output * GetChantPower());
     target->Damage(dmg);
     chant = ChantLevel::Zero;
 }
 void Shrine::UseDismantle(CurseUser* user, Character* target) {
-    if (chant == ChantLevel::Four) std::println("{}\"Maximum Output; DISMANTLE!\"{}", Utilities::Color::Red, Utilities::Color::Clear);
-    println("{} uses {}Dismantle{} on {}!", user->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, target->GetNameWithID());
+    if (chant == ChantLevel::Four) NARRATE(user->Out(), "{}\"Maximum Output; DISMANTLE!\"{}", Utilities::Color::Red, Utilities::Color::Clear);
+    NARRATE(user->Out(), "{} uses {}Dismantle{} on {}!", user->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, target->GetNameWithID());
     double dmg = CalculateDamage(user, slash_output * GetChantPower());
     target->Damage(dmg);
     chant = ChantLevel::Zero;
 }
 void Shrine::UseTheWorldCuttingSlash(CurseUser* user, Character* target) {
     if (this->chant != ChantLevel::Four) {
-        std::println("{} hasn't completed the incantations! {}The slash fails to divide the world...{}", user->GetName(), Utilities::Color::Red,Utilities::Color::Clear);
+        NARRATE(user->Out(), "{} hasn't completed the incantations! {}The slash fails to divide the world...{}", user->GetName(), Utilities::Color::Red,Utilities::Color::Clear);
         return;
     }
-    println("{} uses the {}World Cutting Slash{} on {}!", user->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, target->GetNameWithID());
+    NARRATE(user->Out(), "{} uses the {}World Cutting Slash{} on {}!", user->GetNameWithID(),Utilities::Color::Red,Utilities::Color::Clear, target->GetNameWithID());
     double dmg = CalculateDamage(user, wcs_output);
     target->DamageBypass(dmg);
     chant = ChantLevel::Zero;
@@ -78,7 +87,7 @@ void Shrine::TechniqueMenu(CurseUser* user, Character* target, Battlefield&) {
     }
 }
 
-void Shrine::TechniqueSetting(CurseUser*, Battlefield&) {
+void Shrine::TechniqueSetting(CurseUser* user, Battlefield&) {
     std::println("Chant level: [{}]", this->GetStringChantLevel());
     std::println("1 - Chant | 2 - Return");
     std::print("=> ");
@@ -86,7 +95,7 @@ void Shrine::TechniqueSetting(CurseUser*, Battlefield&) {
     int ch = Utilities::GetValidInput();
     switch (ch) {
     case 1:
-        this->Chant();
+        this->Chant(user);
         break;
     case 2:
         break;
@@ -95,30 +104,30 @@ void Shrine::TechniqueSetting(CurseUser*, Battlefield&) {
     }
 }
 
-void Shrine::Chant() {
+void Shrine::Chant(CurseUser* user) {
     if (chant == ChantLevel::Zero) {
-        std::println("{}\"Scale of the Dragon\"{}",Utilities::Color::BrightRed,Utilities::Color::Clear);
+        NARRATE(user->Out(), "{}\"Scale of the Dragon\"{}",Utilities::Color::BrightRed,Utilities::Color::Clear);
         chant = ChantLevel::One;
     }
     else if (chant == ChantLevel::One) {
-        std::println("{}\"Recoil.\"{}", Utilities::Color::BrightRed, Utilities::Color::Clear);
+        NARRATE(user->Out(), "{}\"Recoil.\"{}", Utilities::Color::BrightRed, Utilities::Color::Clear);
         chant = ChantLevel::Two;
     }
     else if (chant == ChantLevel::Two) {
-        std::println("{}\"Twin Meteors.\"{}", Utilities::Color::Red, Utilities::Color::Clear);
+        NARRATE(user->Out(), "{}\"Twin Meteors.\"{}", Utilities::Color::Red, Utilities::Color::Clear);
         chant = ChantLevel::Three;
     }
     else if (chant == ChantLevel::Three) {
-        std::println("{}\"Silence. Desolation. Anatomy of Ruin.\"{}", Utilities::Color::Red, Utilities::Color::Clear);
+        NARRATE(user->Out(), "{}\"Silence. Desolation. Anatomy of Ruin.\"{}", Utilities::Color::Red, Utilities::Color::Clear);
         chant = ChantLevel::Four;
     }
     else {
-        std::println("The technique is already at maximum output. Sever them!");
+        NARRATE(user->Out(), "The technique is already at maximum output. Sever them!");
     }
 }
 
 bool Shrine::AutoTechniqueUse(CurseUser* user, Character* target, Battlefield&) {
-    if (Utilities::GetRandomNumber(1, 30) >= 25) {
+    if (user->GetRandom().Next(1, 30) >= 25) {
         UseCleave(user, target);
         return true;
     }
@@ -128,8 +137,8 @@ bool Shrine::AutoTechniqueUse(CurseUser* user, Character* target, Battlefield&)
             return true;
         }
         else {
-            if (Utilities::GetRandomNumber(1, 10) >= 6 || world_cutting_slash_allowed) {
-                Chant();
+            if (user->GetRandom().Next(1, 10) >= 6 || world_cutting_slash_allowed) {
+                Chant(user);
                 return true;
             }
             else {
@@ -1,10 +1,57 @@
 #include "code/header/Techniques/Techniques.h"
+#include "code/header/Techniques/TechniqueList.h"
+#include "code/header/Techniques/PrivatePureLoveTrain.h"
 #include "code/header/Characters/CurseUsers/CurseUser.h"
 #include "code/header/Characters/Character.h"
 #include "code/header/GameManagement/Utils.h"
 
 Technique::~Technique() = default;
 
+Technique::Kind Technique::GetKind() const {
+    return kind;
+}
+
+bool Technique::KindMatchesType() const {
+    switch (kind) {
+    case Kind::Copy: return typeid(*this) == typeid(Copy);
+    case Kind::IdleTransfiguration: return typeid(*this) == typeid(IdleTransfiguration);
+    case Kind::Limitless: return typeid(*this) == typeid(Limitless);
+    case Kind::PrivatePureLoveTrain: return typeid(*this) == typeid(PrivatePureLoveTrain);
+    case Kind::Shrine: return typeid(*this) == typeid(Shrine);
+    case Kind::Other: return true;
+    }
+    return false;
+}
+
+bool Technique::DispatchAutoUse(CurseUser* user, Character* target, Battlefield& bf) {
+    assert(KindMatchesType());
+    switch (kind) {
+    case Kind::Copy: return static_cast<Copy&>(*this).AutoTechniqueUse(user, target, bf);
+    case Kind::IdleTransfiguration: return static_cast<IdleTransfiguration&>(*this).AutoTechniqueUse(user, target, bf);
+    case Kind::Limitless: return static_cast<Limitless&>(*this).AutoTechniqueUse(user, target, bf);
+    case Kind::PrivatePureLoveTrain: return static_cast<PrivatePureLoveTrain&>(*this).AutoTechniqueUse(user, target, bf);
+    case Kind::Shrine: return static_cast<Shrine&>(*this).AutoTechniqueUse(user, target, bf);
+    case Kind::Other: break;
+    }
+    return AutoTechniqueUse(user, target, bf);
+}
+
+std::string_view Technique::RosterName() const {
+    switch (kind) {
+    case Kind::Copy: return Copy::roster_name;
+    case Kind::IdleTransfiguration: return IdleTransfiguration::roster_name;
+    case Kind::Limitless: return Limitless::roster_name;
+    case Kind::PrivatePureLoveTrain: return PrivatePureLoveTrain::roster_name;
+    case Kind::Shrine: return Shrine::roster_name;
+    case Kind::Other: break;
+    }
+    return name;
+}
+
+bool Technique::Tune(std::string_view, double) {
+    return false;
+}
+
 void Technique::Set(Status s) {
     state = s;
 }
@@ -17,33 +64,37 @@ std::string Technique::GetTechniqueName() const {
     return std::format("{}{}{}",color,name,Utilities::Color::Clear);
 }
 std::string Technique::GetTechniqueSimpleName() const {
-    return name;
+    return std::string(name);
+}
+// Same as comparing GetTechniqueName()s, without formatting either.
+bool Technique::SameTechniqueAs(const Technique& other) const {
+    return name == other.name && color == other.color;
 }
 
-void Technique::Chant() {
+void Technique::Chant(CurseUser* user) {
     switch(chant){
         case ChantLevel::Zero: {
-            std::println("You chant once");
+            NARRATE(user->Out(), "You chant once");
             chant = ChantLevel::One;
             break;
         }
         case ChantLevel::One: {
-            std::println("You chant twice");
+            NARRATE(user->Out(), "You chant twice");
             chant = ChantLevel::Two;
             break;
         }
         case ChantLevel::Two: {
-            std::println("You chant three times");
+            NARRATE(user->Out(), "You chant three times");
             chant = ChantLevel::Three;
             break;
         }
         case ChantLevel::Three: {
-            std::println("You chant four times");
+            NARRATE(user->Out(), "You chant four times");
             chant = ChantLevel::Four;   
             break;
         }
         case ChantLevel::Four:{
-            std::println("Your technique is at maximum output, use it now!");
+            NARRATE(user->Out(), "Your technique is at maximum output, use it now!");
             break;
         }
     }
@@ -88,7 +139,7 @@ double Technique::CalculateDamage(CurseUser* user, double cost) const {
     double currentCE = user->GetCharacterCE();
 
     if (currentCE < cost) {
-        std::println("Insufficient Cursed Energy! Output weakened.");
+        NARRATE(user->Out(), "Insufficient Cursed Energy! Output weakened.");
         user->SpendCE(currentCE); 
         return currentCE * multiplier;
     }
@@ -0,0 +1,44 @@
+#include "code/header/GameManagement/BattleRandom.h"
+
+// Known-answer vectors for Philox4x32-10 from Random123's kat_vectors, so a
+// change to the round function cannot pass as a mere reseed of every battle.
+struct PhiloxVector {
+	std::array<std::uint32_t, 4> counter;
+	std::array<std::uint32_t, 2> key;
+	std::array<std::uint32_t, 4> expected;
+};
+
+static const std::array<PhiloxVector, 3> vectors = { {
+	{ { 0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u }, { 0x00000000u, 0x00000000u },
+	  { 0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u } },
+	{ { 0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu }, { 0xffffffffu, 0xffffffffu },
+	  { 0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu } },
+	{ { 0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u }, { 0xa4093822u, 0x299f31d0u },
+	  { 0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u } },
+} };
+
+int main() {
+	int failures = 0;
+	for (const PhiloxVector& v : vectors) {
+		std::array<std::uint32_t, 4> got = BattleRandom::Philox(v.counter, v.key);
+		if (got != v.expected) {
+			std::println("Philox4x32-10 mismatch for counter {:08x} {:08x} {:08x} {:08x}: got {:08x} {:08x} {:08x} {:08x}",
+				v.counter[0], v.counter[1], v.counter[2], v.counter[3], got[0], got[1], got[2], got[3]);
+			failures++;
+		}
+	}
+
+	// The generator's first block for seed 0, stream 0 is the all-zero vector.
+	BattleRandom zero(0, 0);
+	std::array<int, 4> words{};
+	for (int& w : words) w = zero.Next(std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+	for (size_t i = 0; i < words.size(); i++) {
+		if (static_cast<std::uint32_t>(words[i]) - 0x80000000u != vectors[0].expected[i]) {
+			std::println("BattleRandom(0, 0) word {} does not come from the all-zero block", i);
+			failures++;
+		}
+	}
+
+	if (failures == 0) std::println("Philox4x32-10 known answers match");
+	return failures == 0 ? 0 : 1;
+}
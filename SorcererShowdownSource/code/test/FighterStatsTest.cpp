@@ -0,0 +1,51 @@
+#include "code/header/GameManagement/FighterStats.h"
+#include "code/header/Characters/CurseUsers/CursedSpirits/CursedSpirit.h"
+#include "code/header/Characters/PhysicallyGifted/PhysicallyGifted.h"
+
+// The batched end of turn regen must match the per-fighter Regen it replaced:
+// cursed spirits and the physically gifted always take min(health + regen, max),
+// which clamps an over-max fighter even at zero regen and applies negative
+// regen. Every other kind is left alone.
+struct RegenCase {
+	const char* name;
+	Character* fighter;
+	double health;
+	double expected;
+};
+
+int main() {
+	CursedSpirit idle_spirit(500.0, 1000.0, 10.0);
+	idle_spirit.SetPassiveRegen(0.0);
+	CursedSpirit draining_spirit(500.0, 1000.0, 10.0);
+	draining_spirit.SetPassiveRegen(-20.0);
+	CursedSpirit spirit(500.0, 1000.0, 10.0);
+	PhysicallyGifted gifted(800.0, 100.0);
+	Character bystander(400.0);
+
+	std::array<RegenCase, 5> cases = { {
+		{ "cursed spirit above max with zero regen", &idle_spirit, 650.0, 500.0 },
+		{ "cursed spirit with negative regen", &draining_spirit, 300.0, 280.0 },
+		{ "cursed spirit near max", &spirit, 498.0, 500.0 },
+		{ "physically gifted above max", &gifted, 900.0, 800.0 },
+		{ "plain fighter above max", &bystander, 450.0, 450.0 },
+	} };
+
+	FighterStats table;
+	for (RegenCase& c : cases) {
+		c.fighter->AttachStats(table);
+		c.fighter->SetHealth(c.health);
+	}
+	table.RegenHealth();
+
+	int failures = 0;
+	for (const RegenCase& c : cases) {
+		double got = c.fighter->GetCharacterHealth();
+		if (got != c.expected) {
+			std::println("{}: expected {:.1f} health after regen, got {:.1f}", c.name, c.expected, got);
+			failures++;
+		}
+	}
+
+	if (failures == 0) std::println("Batched passive regen matches Regen");
+	return failures == 0 ? 0 : 1;
+}